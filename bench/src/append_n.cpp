@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <tgp/vector.h>
+
+namespace {
+
+// state.range(0) values of 1 to 4 bytes each, LEB128 encoded
+std::vector<std::uint8_t> make_varints(const std::int64_t n) {
+    std::vector<std::uint8_t> bytes;
+    std::minstd_rand rng{12345};
+    for (std::int64_t i = 0; i < n; ++i) {
+        const auto r = static_cast<std::uint32_t>(rng());
+        // the engine yields 31 bits, keep 28, 21, 14 or 7 of them
+        std::uint32_t value = r >> (r % 4 * 7 + 3);
+        while (value >= 0x80) {
+            bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<std::uint8_t>(value));
+    }
+    return bytes;
+}
+
+inline const std::uint8_t* decode_one(const std::uint8_t* p, std::uint32_t& value) {
+    std::uint32_t v = 0;
+    int shift = 0;
+    while (*p & 0x80) {
+        v |= static_cast<std::uint32_t>(*p++ & 0x7f) << shift;
+        shift += 7;
+    }
+    value = v | static_cast<std::uint32_t>(*p++) << shift;
+    return p;
+}
+
+void BM_varint_decode_push_back(benchmark::State& state) {
+    const std::vector<std::uint8_t> bytes = make_varints(state.range(0));
+    for (auto _ : state) {
+        tgp::vector<std::uint32_t> out;
+        for (const std::uint8_t* p = bytes.data(); p != bytes.data() + bytes.size();) {
+            std::uint32_t value;
+            p = decode_one(p, value);
+            out.push_back(value);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// every byte ends at most one value, so the input size bounds the output
+void BM_varint_decode_append_n(benchmark::State& state) {
+    const std::vector<std::uint8_t> bytes = make_varints(state.range(0));
+    for (auto _ : state) {
+        tgp::vector<std::uint32_t> out;
+        out.append_n(bytes.size(), [&bytes](std::uint32_t* o, std::size_t) {
+            std::uint32_t* const first = o;
+            for (const std::uint8_t* p = bytes.data(); p != bytes.data() + bytes.size();)
+                p = decode_one(p, *o++);
+            return static_cast<std::size_t>(o - first);
+        });
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_varint_decode_push_back)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK(BM_varint_decode_append_n)->RangeMultiplier(16)->Range(256, 1 << 20);
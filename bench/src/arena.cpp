@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include <tgp/arena.h>
+#include <tgp/vector.h>
+
+namespace {
+
+constexpr int vectors_per_request = 32;
+
+// a request building many short vectors of a few to a few dozen elements, all dropped at the end
+template<class Alloc>
+void handle_request(Alloc alloc, std::minstd_rand& rng) {
+    tgp::vector<tgp::vector<std::uint64_t, Alloc>, std::allocator<tgp::vector<std::uint64_t, Alloc>>> vs;
+    vs.reserve(vectors_per_request);
+    for (int i = 0; i < vectors_per_request; ++i) {
+        const auto n = static_cast<std::uint32_t>(1 + rng() % 32);
+        vs.emplace_back(alloc);
+        for (std::uint32_t j = 0; j < n; ++j)
+            vs.back().push_back(j);
+    }
+    benchmark::DoNotOptimize(vs.data());
+}
+
+void BM_request_std_allocator(benchmark::State& state) {
+    std::minstd_rand rng{12345};
+    for (auto _ : state)
+        handle_request(std::allocator<std::uint64_t>(), rng);
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_request_arena_allocator(benchmark::State& state) {
+    tgp::arena a;
+    std::minstd_rand rng{12345};
+    for (auto _ : state) {
+        handle_request(tgp::arena_allocator<std::uint64_t>(a), rng);
+        a.reset();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_request_std_allocator);
+BENCHMARK(BM_request_arena_allocator);
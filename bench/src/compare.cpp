@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include <tgp/compare.h>
+#include <tgp/vector.h>
+
+namespace {
+
+// two keys differing in their last element only, the worst case of a dedup lookup
+template<class T>
+tgp::vector<T> make_key(std::int64_t n, T last) {
+    tgp::vector<T> key(static_cast<std::size_t>(n), T(7));
+    key.back() = last;
+    return key;
+}
+
+template<class T>
+void BM_equal_std(benchmark::State& state) {
+    const auto a = make_key<T>(state.range(0), 1), b = make_key<T>(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::equal(a.begin(), a.end(), b.begin(), b.end()));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(T)));
+}
+
+template<class T>
+void BM_equal_tgp(benchmark::State& state) {
+    const auto a = make_key<T>(state.range(0), 1), b = make_key<T>(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(a == b);
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(T)));
+}
+
+template<class T>
+void BM_less_std(benchmark::State& state) {
+    const auto a = make_key<T>(state.range(0), 1), b = make_key<T>(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(T)));
+}
+
+template<class T>
+void BM_less_tgp(benchmark::State& state) {
+    const auto a = make_key<T>(state.range(0), 1), b = make_key<T>(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(a < b);
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(T)));
+}
+
+template<class T>
+void BM_three_way_tgp(benchmark::State& state) {
+    const auto a = make_key<T>(state.range(0), 1), b = make_key<T>(state.range(0), 2);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(a <=> b);
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(T)));
+}
+
+} // end of unnamed namespace
+
+#define TGP_COMPARE_BENCHMARKS(T)                                                    \
+    BENCHMARK_TEMPLATE(BM_equal_std, T)->RangeMultiplier(8)->Range(8, 1 << 15);     \
+    BENCHMARK_TEMPLATE(BM_equal_tgp, T)->RangeMultiplier(8)->Range(8, 1 << 15);     \
+    BENCHMARK_TEMPLATE(BM_less_std, T)->RangeMultiplier(8)->Range(8, 1 << 15);      \
+    BENCHMARK_TEMPLATE(BM_less_tgp, T)->RangeMultiplier(8)->Range(8, 1 << 15);      \
+    BENCHMARK_TEMPLATE(BM_three_way_tgp, T)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+TGP_COMPARE_BENCHMARKS(std::uint8_t)
+TGP_COMPARE_BENCHMARKS(std::int32_t)
+TGP_COMPARE_BENCHMARKS(std::uint64_t)
@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include <tgp/concurrent_vector.h>
+#include <tgp/vector.h>
+
+namespace {
+
+constexpr int appends_per_iteration = 1024;
+
+// every thread appends into one shared sequence, created and destroyed by thread 0 outside the timed loop
+void BM_append_concurrent_vector(benchmark::State& state) {
+    static std::unique_ptr<tgp::concurrent_vector<std::uint64_t>> shared;
+    if (state.thread_index() == 0)
+        shared = std::make_unique<tgp::concurrent_vector<std::uint64_t>>();
+    for (auto _ : state) {
+        for (int i = 0; i < appends_per_iteration; ++i)
+            shared->emplace_back(static_cast<std::uint64_t>(i));
+    }
+    state.SetItemsProcessed(state.iterations() * appends_per_iteration);
+    if (state.thread_index() == 0)
+        shared.reset();
+}
+
+void BM_append_locked_vector(benchmark::State& state) {
+    static std::unique_ptr<tgp::vector<std::uint64_t>> shared;
+    static std::mutex mutex;
+    if (state.thread_index() == 0)
+        shared = std::make_unique<tgp::vector<std::uint64_t>>();
+    for (auto _ : state) {
+        for (int i = 0; i < appends_per_iteration; ++i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            shared->emplace_back(static_cast<std::uint64_t>(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * appends_per_iteration);
+    if (state.thread_index() == 0)
+        shared.reset();
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_append_concurrent_vector)->ThreadRange(1, 64)->Iterations(256)->UseRealTime();
+BENCHMARK(BM_append_locked_vector)->ThreadRange(1, 64)->Iterations(256)->UseRealTime();
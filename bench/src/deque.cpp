@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <deque>
+
+#include <tgp/deque.h>
+#include <tgp/vector.h>
+
+namespace {
+
+// a work queue holding state.range(0) items, every iteration retires the oldest and enqueues a new one
+template<class Queue, class Pop>
+void run_fifo(benchmark::State& state, Pop pop) {
+    const auto depth = static_cast<std::uint64_t>(state.range(0));
+    Queue queue;
+    for (std::uint64_t i = 0; i < depth; ++i)
+        queue.push_back(i);
+    std::uint64_t next = depth;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(queue.front());
+        pop(queue);
+        queue.push_back(next++);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_fifo_vector_erase_front(benchmark::State& state) {
+    run_fifo<tgp::vector<std::uint64_t>>(state, [](auto& q) { q.erase(q.begin()); });
+}
+
+void BM_fifo_tgp_deque(benchmark::State& state) {
+    run_fifo<tgp::deque<std::uint64_t>>(state, [](auto& q) { q.pop_front(); });
+}
+
+void BM_fifo_std_deque(benchmark::State& state) {
+    run_fifo<std::deque<std::uint64_t>>(state, [](auto& q) { q.pop_front(); });
+}
+
+template<class Deque>
+void run_iterate(benchmark::State& state) {
+    Deque d;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+        d.push_front(static_cast<std::uint64_t>(i));
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const auto v : d)
+            sum += v;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_iterate_tgp_deque(benchmark::State& state) {
+    run_iterate<tgp::deque<std::uint64_t>>(state);
+}
+
+void BM_iterate_std_deque(benchmark::State& state) {
+    run_iterate<std::deque<std::uint64_t>>(state);
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_fifo_vector_erase_front)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_fifo_tgp_deque)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_fifo_std_deque)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_iterate_tgp_deque)->Arg(1 << 16);
+BENCHMARK(BM_iterate_std_deque)->Arg(1 << 16);
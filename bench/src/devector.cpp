@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+#include <random>
+
+#include <tgp/devector.h>
+#include <tgp/vector.h>
+
+namespace {
+
+// builds state.range(0) elements by prepending each one
+template<class Seq, class PushFront>
+void run_push_front(benchmark::State& state, PushFront push_front) {
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    for (auto _ : state) {
+        Seq seq;
+        for (std::uint64_t i = 0; i < n; ++i)
+            push_front(seq, i);
+        benchmark::DoNotOptimize(seq.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_push_front_vector_insert(benchmark::State& state) {
+    run_push_front<tgp::vector<std::uint64_t>>(state, [](auto& v, std::uint64_t i) { v.insert(v.begin(), i); });
+}
+
+void BM_push_front_devector(benchmark::State& state) {
+    run_push_front<tgp::devector<std::uint64_t>>(state, [](auto& v, std::uint64_t i) { v.push_front(i); });
+}
+
+// inserts and then erases one element at a random position of a sequence holding state.range(0) elements
+template<class Seq>
+void run_middle(benchmark::State& state) {
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    Seq seq;
+    for (std::uint64_t i = 0; i < n; ++i)
+        seq.push_back(i);
+    std::minstd_rand rng{12345};
+    for (auto _ : state) {
+        const std::uint64_t r = rng();
+        seq.insert(seq.begin() + static_cast<std::ptrdiff_t>(r % n), r);
+        seq.erase(seq.begin() + static_cast<std::ptrdiff_t>(rng() % n));
+    }
+    benchmark::DoNotOptimize(seq.data());
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_middle_vector(benchmark::State& state) {
+    run_middle<tgp::vector<std::uint64_t>>(state);
+}
+
+void BM_middle_devector(benchmark::State& state) {
+    run_middle<tgp::devector<std::uint64_t>>(state);
+}
+
+// sums through data() like a kernel handed a plain array would
+template<class Seq>
+void run_data_sum(benchmark::State& state) {
+    Seq seq;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+        seq.push_back(static_cast<std::uint64_t>(i));
+    for (auto _ : state) {
+        const std::uint64_t* p = seq.data();
+        benchmark::DoNotOptimize(std::accumulate(p, p + seq.size(), std::uint64_t(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_data_sum_vector(benchmark::State& state) {
+    run_data_sum<tgp::vector<std::uint64_t>>(state);
+}
+
+void BM_data_sum_devector(benchmark::State& state) {
+    run_data_sum<tgp::devector<std::uint64_t>>(state);
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_push_front_vector_insert)->RangeMultiplier(8)->Range(64, 1 << 15);
+BENCHMARK(BM_push_front_devector)->RangeMultiplier(8)->Range(64, 1 << 15);
+BENCHMARK(BM_middle_vector)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_middle_devector)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK(BM_data_sum_vector)->Arg(1 << 16);
+BENCHMARK(BM_data_sum_devector)->Arg(1 << 16);
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <tgp/vector.h>
+
+namespace {
+
+constexpr std::int64_t element_count = 1 << 14;
+
+// every state.range(0)-th index, the cleanup pass of one tick
+std::vector<std::size_t> make_indices(const std::int64_t stride) {
+    std::vector<std::size_t> indices;
+    for (std::int64_t i = 0; i < element_count; i += stride)
+        indices.push_back(static_cast<std::size_t>(i));
+    return indices;
+}
+
+template<class T>
+tgp::vector<T> make_elements() {
+    tgp::vector<T> c;
+    for (std::int64_t i = 0; i < element_count; ++i)
+        c.emplace_back(static_cast<int>(i));
+    return c;
+}
+
+struct entity {
+    int id;
+    std::string name;
+
+    entity(int i) : id(i), name(24, 'x') {}
+};
+
+// erases back to front one element at a time, each call shifting the tail
+template<class T>
+void BM_erase_one_by_one(benchmark::State& state) {
+    const std::vector<std::size_t> indices = make_indices(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        tgp::vector<T> c = make_elements<T>();
+        state.ResumeTiming();
+        for (auto it = indices.rbegin(); it != indices.rend(); ++it)
+            c.erase(c.begin() + static_cast<std::ptrdiff_t>(*it));
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(indices.size()));
+}
+
+template<class T>
+void BM_erase_indices(benchmark::State& state) {
+    const std::vector<std::size_t> indices = make_indices(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        tgp::vector<T> c = make_elements<T>();
+        state.ResumeTiming();
+        c.erase_indices(indices);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(indices.size()));
+}
+
+} // end of unnamed namespace
+
+BENCHMARK_TEMPLATE(BM_erase_one_by_one, int)->Arg(4)->Arg(64);
+BENCHMARK_TEMPLATE(BM_erase_indices, int)->Arg(4)->Arg(64);
+BENCHMARK_TEMPLATE(BM_erase_one_by_one, entity)->Arg(4)->Arg(64);
+BENCHMARK_TEMPLATE(BM_erase_indices, entity)->Arg(4)->Arg(64);
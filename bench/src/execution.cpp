@@ -0,0 +1,34 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <tgp/execution.h>
+#include <tgp/vector.h>
+
+namespace {
+
+// construction of a fresh table, page faults included
+void BM_fill_construct(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0)) / sizeof(float);
+    for (auto _ : state) {
+        tgp::vector<float> table(n, 1.5f);
+        benchmark::DoNotOptimize(table.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void BM_fill_construct_parallel(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0)) / sizeof(float);
+    const tgp::parallel_policy policy{static_cast<unsigned>(state.range(1))};
+    for (auto _ : state) {
+        tgp::vector<float> table(policy, n, 1.5f);
+        benchmark::DoNotOptimize(table.data());
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_fill_construct)->Arg(std::int64_t(1) << 28)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_fill_construct_parallel)
+    ->ArgsProduct({{std::int64_t(1) << 28}, {2, 4, 8}})->Unit(benchmark::kMillisecond)->UseRealTime();
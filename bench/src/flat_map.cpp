@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <tgp/flat_map.h>
+
+namespace {
+
+std::vector<std::pair<std::uint64_t, std::uint64_t>> make_pairs(const std::int64_t n) {
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> pairs;
+    std::mt19937_64 rng{12345};
+    for (std::int64_t i = 0; i < n; ++i)
+        pairs.emplace_back(rng() >> 16, static_cast<std::uint64_t>(i));
+    return pairs;
+}
+
+// looks up random present keys in a map of state.range(0) elements
+template<class Map>
+void run_lookup(benchmark::State& state) {
+    const auto pairs = make_pairs(state.range(0));
+    const Map map(pairs.begin(), pairs.end());
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(pairs[i].first)->second);
+        i = (i + 7919) % pairs.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_lookup_std_map(benchmark::State& state) {
+    run_lookup<std::map<std::uint64_t, std::uint64_t>>(state);
+}
+
+void BM_lookup_flat_map(benchmark::State& state) {
+    run_lookup<tgp::flat_map<std::uint64_t, std::uint64_t>>(state);
+}
+
+// builds a map of state.range(0) random elements
+void BM_build_flat_map_one_by_one(benchmark::State& state) {
+    const auto pairs = make_pairs(state.range(0));
+    for (auto _ : state) {
+        tgp::flat_map<std::uint64_t, std::uint64_t> map;
+        for (const auto& p : pairs)
+            map.insert(p);
+        benchmark::DoNotOptimize(map.keys().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_build_flat_map_bulk(benchmark::State& state) {
+    const auto pairs = make_pairs(state.range(0));
+    for (auto _ : state) {
+        tgp::flat_map<std::uint64_t, std::uint64_t> map;
+        map.insert(pairs.begin(), pairs.end());
+        benchmark::DoNotOptimize(map.keys().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_lookup_std_map)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK(BM_lookup_flat_map)->RangeMultiplier(16)->Range(256, 1 << 20);
+BENCHMARK(BM_build_flat_map_one_by_one)->RangeMultiplier(8)->Range(512, 1 << 15);
+BENCHMARK(BM_build_flat_map_bulk)->RangeMultiplier(8)->Range(512, 1 << 15);
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+#include <tgp/vector.h>
+
+namespace {
+
+// tracks the bytes held by the vector, including both buffers while it relocates
+template<class T>
+struct peak_tracking_allocator {
+    using value_type = T;
+
+    static inline std::size_t live = 0;
+    static inline std::size_t peak = 0;
+
+    peak_tracking_allocator() = default;
+
+    template<class U>
+    peak_tracking_allocator(const peak_tracking_allocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        live += n * sizeof(T);
+        peak = std::max(peak, live);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        live -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const peak_tracking_allocator&, const peak_tracking_allocator&) { return true; }
+};
+
+template<class Policy>
+void BM_push_back_growth(benchmark::State& state) {
+    using alloc = peak_tracking_allocator<std::uint64_t>;
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    std::size_t capacity = 0;
+    alloc::peak = 0;
+    for (auto _ : state) {
+        tgp::vector<std::uint64_t, alloc, Policy> v;
+        for (std::uint64_t i = 0; i < n; ++i)
+            v.push_back(i);
+        benchmark::DoNotOptimize(v.data());
+        capacity = v.capacity();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+    state.counters["peak_bytes"]  = static_cast<double>(alloc::peak);
+    state.counters["final_slack"] = static_cast<double>(capacity - n) / static_cast<double>(capacity);
+}
+
+} // end of unnamed namespace
+
+BENCHMARK_TEMPLATE(BM_push_back_growth, tgp::double_growth)
+    ->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_push_back_growth, tgp::one_and_half_growth)
+    ->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_push_back_growth, tgp::page_rounded_growth<tgp::one_and_half_growth>)
+    ->RangeMultiplier(10)->Range(1000, 10000000);
+BENCHMARK_TEMPLATE(BM_push_back_growth, tgp::size_class_rounded_growth<tgp::one_and_half_growth>)
+    ->RangeMultiplier(10)->Range(1000, 10000000);
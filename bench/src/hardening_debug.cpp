@@ -0,0 +1,9 @@
+#define TGP_HARDENING_MODE TGP_HARDENING_MODE_DEBUG
+
+#include "hardening_suite.h"
+
+using namespace hardening_suite;
+
+using debug_vector = tgp::vector<element<TGP_HARDENING_MODE_DEBUG>>;
+
+TGP_HARDENING_BENCHMARKS(debug_vector)
@@ -0,0 +1,9 @@
+#define TGP_HARDENING_MODE TGP_HARDENING_MODE_EXTENSIVE
+
+#include "hardening_suite.h"
+
+using namespace hardening_suite;
+
+using extensive_vector = tgp::vector<element<TGP_HARDENING_MODE_EXTENSIVE>>;
+
+TGP_HARDENING_BENCHMARKS(extensive_vector)
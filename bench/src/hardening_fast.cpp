@@ -0,0 +1,9 @@
+#define TGP_HARDENING_MODE TGP_HARDENING_MODE_FAST
+
+#include "hardening_suite.h"
+
+using namespace hardening_suite;
+
+using fast_vector = tgp::vector<element<TGP_HARDENING_MODE_FAST>>;
+
+TGP_HARDENING_BENCHMARKS(fast_vector)
@@ -0,0 +1,9 @@
+#define TGP_HARDENING_MODE TGP_HARDENING_MODE_NONE
+
+#include "hardening_suite.h"
+
+using namespace hardening_suite;
+
+using none_vector = tgp::vector<element<TGP_HARDENING_MODE_NONE>>;
+
+TGP_HARDENING_BENCHMARKS(none_vector)
@@ -0,0 +1,93 @@
+#ifndef TSTL_BENCH_SRC_HARDENING_SUITE_H
+#define TSTL_BENCH_SRC_HARDENING_SUITE_H
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <tgp/vector.h>
+
+/*
+ * the hot loops that the checks of the fast mode sit in. hardening_<mode>.cpp each define TGP_HARDENING_MODE
+ * before including this, and instantiate the loops over an element type of their own: a vector of the same type
+ * built in two modes would be one function to the linker, which keeps either of them.
+ */
+namespace hardening_suite {
+
+template<int Mode>
+struct element {
+    std::uint64_t value = 0;
+
+    element() = default;
+    element(std::uint64_t v) noexcept : value(v) {}
+};
+
+template<class Vec>
+Vec make_filled(const std::int64_t n) {
+    Vec v;
+    v.reserve(static_cast<std::size_t>(n));
+    for (std::int64_t i = 0; i < n; ++i)
+        v.emplace_back(static_cast<std::uint64_t>(i));
+    return v;
+}
+
+// one bounds check per element, the loop the compiler would otherwise vectorize
+template<class Vec>
+void BM_index_sum(benchmark::State& state) {
+    const Vec v = make_filled<Vec>(state.range(0));
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < v.size(); ++i)
+            sum += v[i].value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// a gather through indices the compiler can't prove in bounds
+template<class Vec>
+void BM_index_gather(benchmark::State& state) {
+    const Vec v = make_filled<Vec>(state.range(0));
+    std::vector<std::uint32_t> indices(static_cast<std::size_t>(state.range(0)));
+    std::minstd_rand rng{12345};
+    for (auto& index : indices)
+        index = static_cast<std::uint32_t>(rng() % static_cast<std::uint64_t>(state.range(0)));
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const std::uint32_t index : indices)
+            sum += v[index].value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// a work stack, checking back and pop_back on every step
+template<class Vec>
+void BM_stack(benchmark::State& state) {
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    Vec v;
+    v.reserve(n);
+    for (auto _ : state) {
+        for (std::uint64_t i = 0; i < n; ++i)
+            v.emplace_back(i);
+        std::uint64_t sum = 0;
+        while (!v.empty()) {
+            sum += v.back().value;
+            v.pop_back();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // end of namespace hardening_suite
+
+// registers the loops for the mode the including file builds with, expand it after using namespace hardening_suite
+#define TGP_HARDENING_BENCHMARKS(Vec)                                           \
+    BENCHMARK_TEMPLATE(BM_index_sum, Vec)->Arg(1 << 10)->Arg(1 << 20);         \
+    BENCHMARK_TEMPLATE(BM_index_gather, Vec)->Arg(1 << 10)->Arg(1 << 20);      \
+    BENCHMARK_TEMPLATE(BM_stack, Vec)->Arg(1 << 10)->Arg(1 << 20);
+
+#endif // end of TSTL_BENCH_SRC_HARDENING_SUITE_H
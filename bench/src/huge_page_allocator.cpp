@@ -0,0 +1,32 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include <tgp/huge_page_allocator.h>
+#include <tgp/vector.h>
+
+namespace {
+
+// random lookups into an embeddings-like table, dominated by TLB misses once it outgrows the TLB reach
+template<class Alloc>
+void BM_random_access(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0)) / sizeof(float);
+    tgp::vector<float, Alloc> table(n, 1.0f);
+    std::minstd_rand rng{42};
+    float sum = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i)
+            sum += table[rng() % n];
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+
+} // end of unnamed namespace
+
+BENCHMARK_TEMPLATE(BM_random_access, std::allocator<float>)
+    ->RangeMultiplier(8)->Range(std::int64_t(1) << 24, std::int64_t(1) << 30);
+BENCHMARK_TEMPLATE(BM_random_access, tgp::huge_page_allocator<float>)
+    ->RangeMultiplier(8)->Range(std::int64_t(1) << 24, std::int64_t(1) << 30);
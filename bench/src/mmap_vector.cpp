@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include <tgp/mmap_vector.h>
+#include <tgp/vector.h>
+
+namespace {
+
+struct record {
+    std::uint64_t key;
+    double        value;
+};
+
+std::string table_path(std::int64_t n) {
+    std::string path = "/tmp/tgp_bench_mmap_vector_" + std::to_string(n);
+    tgp::mmap_vector<record> table(path.c_str());
+    if (table.size() != static_cast<std::size_t>(n)) {
+        table.clear();
+        for (std::int64_t i = 0; i < n; ++i)
+            table.push_back({static_cast<std::uint64_t>(i), static_cast<double>(i)});
+        table.sync();
+    }
+    return path;
+}
+
+// the old startup path, reading the records back one by one into a vector
+void BM_startup_rebuild(benchmark::State& state) {
+    const std::string path = table_path(state.range(0));
+    for (auto _ : state) {
+        tgp::vector<record> table;
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        std::fseek(f, 64, SEEK_SET);
+        record r;
+        for (std::int64_t i = 0; i < state.range(0) && std::fread(&r, sizeof(r), 1, f) == 1; ++i)
+            table.push_back(r);
+        std::fclose(f);
+        benchmark::DoNotOptimize(table.data());
+    }
+}
+
+void BM_startup_mmap(benchmark::State& state) {
+    const std::string path = table_path(state.range(0));
+    for (auto _ : state) {
+        tgp::mmap_vector<record> table(path.c_str(), tgp::mmap_mode::read_only);
+        benchmark::DoNotOptimize(table.data());
+    }
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_startup_rebuild)->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_startup_mmap)->RangeMultiplier(16)->Range(1 << 12, 1 << 24)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include <tgp/recycling_allocator.h>
+#include <tgp/tracking_allocator.h>
+#include <tgp/vector.h>
+
+namespace {
+
+constexpr int vectors_per_request = 16;
+
+// a request growing vectors of a few dozen to a few thousand elements by push_back, all dropped at the end,
+// so every request walks through the same capacities
+template<class Alloc>
+void handle_request(const Alloc& alloc, std::minstd_rand& rng) {
+    using inner = tgp::vector<std::uint64_t, Alloc>;
+    using outer_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<inner>;
+    tgp::vector<inner, outer_alloc> vs{outer_alloc(alloc)};
+    for (int i = 0; i < vectors_per_request; ++i) {
+        const auto n = static_cast<std::uint32_t>(32 + rng() % 2048);
+        vs.emplace_back(alloc);
+        for (std::uint32_t j = 0; j < n; ++j)
+            vs.back().push_back(j);
+    }
+    benchmark::DoNotOptimize(vs.data());
+}
+
+void BM_request_std_allocator(benchmark::State& state) {
+    tgp::size_histogram histogram;
+    const tgp::tracking_allocator<std::allocator<std::uint64_t>> alloc(histogram);
+    std::minstd_rand rng{12345};
+    for (auto _ : state)
+        handle_request(alloc, rng);
+    state.SetItemsProcessed(state.iterations());
+    state.counters["allocs_per_request"] =
+        benchmark::Counter(static_cast<double>(histogram.total_count()), benchmark::Counter::kAvgIterations);
+}
+
+void BM_request_recycling_allocator(benchmark::State& state) {
+    tgp::recycling_cache& cache = tgp::recycling_cache::local();
+    cache.reset_stats();
+    std::minstd_rand rng{12345};
+    for (auto _ : state)
+        handle_request(tgp::recycling_allocator<std::uint64_t>(), rng);
+    state.SetItemsProcessed(state.iterations());
+    // what reaches operator new, the first requests fill the cache
+    state.counters["allocs_per_request"] =
+        benchmark::Counter(static_cast<double>(cache.stats().upstream_allocations),
+                           benchmark::Counter::kAvgIterations);
+    const auto hits = static_cast<double>(cache.stats().hits);
+    state.counters["hit_rate"] = benchmark::Counter(
+        hits / (hits + static_cast<double>(cache.stats().upstream_allocations)), benchmark::Counter::kAvgThreads);
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_request_std_allocator)->ThreadRange(1, 8);
+BENCHMARK(BM_request_recycling_allocator)->ThreadRange(1, 8);
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <tgp/vector.h>
+
+namespace {
+
+// a 32-byte handle whose move constructor is not trivial
+template<bool Relocatable>
+struct handle {
+    long  id = 0;
+    void* resource[3] = {};
+
+    handle() = default;
+    handle(long i) : id(i) {}
+    handle(const handle&) = default;
+    handle(handle&& other) noexcept : id(other.id) { other.id = 0; }
+    handle& operator=(const handle&) = default;
+    handle& operator=(handle&& other) noexcept { id = other.id; other.id = 0; return *this; }
+    ~handle() {}
+};
+
+using movable_handle     = handle<false>;
+using relocatable_handle = handle<true>;
+
+} // end of unnamed namespace
+
+template<>
+struct tgp::is_trivially_relocatable<relocatable_handle> : std::true_type {};
+
+namespace {
+
+// every doubling relocates the whole vector into the new split_buffer
+template<class T>
+void BM_relocate_on_growth(benchmark::State& state) {
+    const auto n = static_cast<long>(state.range(0));
+    for (auto _ : state) {
+        tgp::vector<T> v;
+        for (long i = 0; i < n; ++i)
+            v.emplace_back(i);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// every insert and erase at the front shifts the whole vector by one slot
+template<class T>
+void BM_relocate_on_insert_erase(benchmark::State& state) {
+    const auto n = static_cast<long>(state.range(0));
+    tgp::vector<T> v;
+    v.reserve(n + 1);
+    for (long i = 0; i < n; ++i)
+        v.emplace_back(i);
+    for (auto _ : state) {
+        v.emplace(v.begin(), -1);
+        v.erase(v.begin());
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetBytesProcessed(state.iterations() * 2 * n * static_cast<long>(sizeof(T)));
+}
+
+} // end of unnamed namespace
+
+BENCHMARK_TEMPLATE(BM_relocate_on_growth, movable_handle)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_relocate_on_growth, relocatable_handle)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_relocate_on_insert_erase, movable_handle)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK_TEMPLATE(BM_relocate_on_insert_erase, relocatable_handle)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <tgp/small_vector.h>
+#include <tgp/vector.h>
+
+namespace {
+
+// a short-lived per-request container holding a handful of elements
+template<class C>
+void BM_short_lived(benchmark::State& state) {
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    for (auto _ : state) {
+        C c;
+        for (std::uint64_t i = 0; i < n; ++i)
+            c.push_back(i);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+} // end of unnamed namespace
+
+BENCHMARK_TEMPLATE(BM_short_lived, tgp::vector<std::uint64_t>)->DenseRange(2, 16, 2);
+BENCHMARK_TEMPLATE(BM_short_lived, tgp::small_vector<std::uint64_t, 8>)->DenseRange(2, 16, 2);
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <tgp/soa_vector.h>
+#include <tgp/vector.h>
+
+namespace {
+
+struct particle {
+    float x, y, z;
+    float vx, vy, vz;
+    float mass;
+    std::uint32_t id;
+};
+
+// sums one field of state.range(0) particles
+void BM_field_scan_vector(benchmark::State& state) {
+    tgp::vector<particle> particles;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+        particles.push_back(particle{0, 0, 0, 0, 0, 0, static_cast<float>(i % 7), static_cast<std::uint32_t>(i)});
+    for (auto _ : state) {
+        std::uint32_t sum = 0;
+        for (const particle& p : particles)
+            sum += p.id;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_field_scan_soa_vector(benchmark::State& state) {
+    tgp::soa_vector<float, float, float, float, float, float, float, std::uint32_t> particles;
+    for (std::int64_t i = 0; i < state.range(0); ++i)
+        particles.emplace_back(0.f, 0.f, 0.f, 0.f, 0.f, 0.f, static_cast<float>(i % 7), static_cast<std::uint32_t>(i));
+    for (auto _ : state) {
+        std::uint32_t sum = 0;
+        for (const std::uint32_t id : particles.column<7>())
+            sum += id;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// appends state.range(0) rows one at a time
+void BM_push_back_vector(benchmark::State& state) {
+    for (auto _ : state) {
+        tgp::vector<particle> particles;
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+            particles.push_back(particle{1, 2, 3, 4, 5, 6, 7, static_cast<std::uint32_t>(i)});
+        benchmark::DoNotOptimize(particles.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_push_back_soa_vector(benchmark::State& state) {
+    for (auto _ : state) {
+        tgp::soa_vector<float, float, float, float, float, float, float, std::uint32_t> particles;
+        for (std::int64_t i = 0; i < state.range(0); ++i)
+            particles.emplace_back(1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, static_cast<std::uint32_t>(i));
+        benchmark::DoNotOptimize(particles.data<0>());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // end of unnamed namespace
+
+BENCHMARK(BM_field_scan_vector)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_field_scan_soa_vector)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_push_back_vector)->Arg(1 << 16);
+BENCHMARK(BM_push_back_soa_vector)->Arg(1 << 16);
@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <tgp/small_vector.h>
+#include <tgp/static_vector.h>
+
+namespace {
+
+// a per-core scratch list, filled and dropped for every request
+template<class C>
+void BM_scratch_list(benchmark::State& state) {
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    for (auto _ : state) {
+        C c;
+        for (std::uint64_t i = 0; i < n; ++i)
+            c.push_back(i);
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+} // end of unnamed namespace
+
+BENCHMARK_TEMPLATE(BM_scratch_list, tgp::small_vector<std::uint64_t, 16>)->DenseRange(4, 16, 4);
+BENCHMARK_TEMPLATE(BM_scratch_list, tgp::static_vector<std::uint64_t, 16>)->DenseRange(4, 16, 4);
@@ -0,0 +1,13 @@
+#include <vector>
+
+#include "vector_suite.h"
+
+using namespace vector_suite;
+
+using std_trivial    = std::vector<trivial>;
+using std_nontrivial = std::vector<nontrivial>;
+using std_large      = std::vector<large>;
+
+TGP_VECTOR_BENCHMARKS(std_trivial)
+TGP_VECTOR_BENCHMARKS(std_nontrivial)
+TGP_VECTOR_BENCHMARKS(std_large)
@@ -0,0 +1,13 @@
+#include <tgp/vector.h>
+
+#include "vector_suite.h"
+
+using namespace vector_suite;
+
+using tgp_trivial    = tgp::vector<trivial>;
+using tgp_nontrivial = tgp::vector<nontrivial>;
+using tgp_large      = tgp::vector<large>;
+
+TGP_VECTOR_BENCHMARKS(tgp_trivial)
+TGP_VECTOR_BENCHMARKS(tgp_nontrivial)
+TGP_VECTOR_BENCHMARKS(tgp_large)
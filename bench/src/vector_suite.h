@@ -0,0 +1,206 @@
+#ifndef TSTL_BENCH_SRC_VECTOR_SUITE_H
+#define TSTL_BENCH_SRC_VECTOR_SUITE_H
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#ifndef TSTL_BENCH_MAX_BYTES
+#define TSTL_BENCH_MAX_BYTES 800000000
+#endif
+
+/*
+ * the hot paths of a vector over element types that tgp::vector and std::vector handle differently.
+ * vector.cpp registers them for tgp::vector and std_vector.cpp for std::vector: the compiler's inlining budget
+ * is spent per translation unit, so putting both in one file would favour whichever it instantiates first.
+ */
+namespace vector_suite {
+
+// relocated with memmove by tgp::vector
+using trivial = std::uint64_t;
+
+// has its own move constructor and destructor, so both vectors move and destroy element by element
+struct nontrivial {
+    std::uint64_t value = 0;
+
+    nontrivial() = default;
+    nontrivial(std::uint64_t v) noexcept : value(v) {}
+    nontrivial(const nontrivial& other) noexcept : value(other.value) {}
+    nontrivial(nontrivial&& other) noexcept : value(other.value) { other.value = 0; }
+    nontrivial& operator=(const nontrivial& other) noexcept { value = other.value; return *this; }
+    nontrivial& operator=(nontrivial&& other) noexcept { value = other.value; other.value = 0; return *this; }
+    ~nontrivial() { benchmark::DoNotOptimize(value); }
+};
+
+// trivial but large enough that the element count stays low for the same bytes
+struct large {
+    std::uint64_t value[32] = {};
+
+    large() = default;
+    large(std::uint64_t v) noexcept { value[0] = v; }
+};
+
+// 8, 64, 512, ... elements, up to 1e8 or TSTL_BENCH_MAX_BYTES worth of elements, whichever is fewer
+template<class Vec>
+void sizes(benchmark::internal::Benchmark* b) {
+    const auto max_n = std::min<std::int64_t>(100000000, TSTL_BENCH_MAX_BYTES / sizeof(typename Vec::value_type));
+    for (std::int64_t n = 8; n < max_n; n *= 8)
+        b->Arg(n);
+    b->Arg(max_n);
+}
+
+template<class Vec>
+Vec make_filled(const std::int64_t n) {
+    Vec v;
+    v.reserve(static_cast<std::size_t>(n));
+    for (std::int64_t i = 0; i < n; ++i)
+        v.emplace_back(static_cast<std::uint64_t>(i));
+    return v;
+}
+
+template<class Vec>
+void BM_push_back(benchmark::State& state) {
+    using T = typename Vec::value_type;
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    for (auto _ : state) {
+        Vec v;
+        for (std::uint64_t i = 0; i < n; ++i)
+            v.push_back(T(i));
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vec>
+void BM_emplace_back(benchmark::State& state) {
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    for (auto _ : state) {
+        Vec v;
+        for (std::uint64_t i = 0; i < n; ++i)
+            v.emplace_back(i);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vec>
+void BM_push_back_reserved(benchmark::State& state) {
+    using T = typename Vec::value_type;
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    for (auto _ : state) {
+        Vec v;
+        v.reserve(n);
+        for (std::uint64_t i = 0; i < n; ++i)
+            v.push_back(T(i));
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// reserve and shrink_to_fit each relocate all the elements into a new buffer
+template<class Vec>
+void BM_reserve(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    Vec v = make_filled<Vec>(state.range(0));
+    for (auto _ : state) {
+        v.reserve(2 * n);
+        v.shrink_to_fit();
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(2 * state.iterations() * state.range(0));
+}
+
+struct at_front {
+    static std::size_t index(std::size_t) { return 0; }
+};
+
+struct at_middle {
+    static std::size_t index(std::size_t n) { return n / 2; }
+};
+
+struct at_back {
+    static std::size_t index(std::size_t n) { return n; }
+};
+
+// inserts one element at Where and erases it again, so the size stays state.range(0). the spare slot is reserved
+// up front, otherwise the first insert reallocates and that one-off cost skews the iteration count
+template<class Vec, class Where>
+void BM_insert_erase(benchmark::State& state) {
+    using T = typename Vec::value_type;
+    Vec v = make_filled<Vec>(state.range(0));
+    v.reserve(v.size() + 1);
+    const auto pos = static_cast<std::ptrdiff_t>(Where::index(v.size()));
+    std::uint64_t i = 0;
+    for (auto _ : state) {
+        v.insert(v.begin() + pos, T(i++));
+        v.erase(v.begin() + pos);
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// assigns into a vector that already has the capacity
+template<class Vec>
+void BM_assign(benchmark::State& state) {
+    const Vec src = make_filled<Vec>(state.range(0));
+    Vec v = src;
+    for (auto _ : state) {
+        v.assign(src.begin(), src.end());
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vec>
+void BM_copy_construct(benchmark::State& state) {
+    const Vec src = make_filled<Vec>(state.range(0));
+    for (auto _ : state) {
+        Vec copy(src);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Vec>
+void BM_move_construct(benchmark::State& state) {
+    Vec src = make_filled<Vec>(state.range(0));
+    for (auto _ : state) {
+        Vec moved(std::move(src));
+        benchmark::DoNotOptimize(moved.data());
+        src.swap(moved);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// grows to state.range(0) value-initialized elements within the capacity, then shrinks back to empty
+template<class Vec>
+void BM_resize(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    Vec v;
+    v.reserve(n);
+    for (auto _ : state) {
+        v.resize(n);
+        benchmark::DoNotOptimize(v.data());
+        v.resize(0);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // end of namespace vector_suite
+
+// registers the suite for one vector type, expand it after using namespace vector_suite
+#define TGP_VECTOR_BENCHMARKS(Vec)                                                          \
+    BENCHMARK_TEMPLATE(BM_push_back, Vec)->Apply(sizes<Vec>);                              \
+    BENCHMARK_TEMPLATE(BM_emplace_back, Vec)->Apply(sizes<Vec>);                           \
+    BENCHMARK_TEMPLATE(BM_push_back_reserved, Vec)->Apply(sizes<Vec>);                     \
+    BENCHMARK_TEMPLATE(BM_reserve, Vec)->Apply(sizes<Vec>);                                \
+    BENCHMARK_TEMPLATE(BM_insert_erase, Vec, at_front)->Apply(sizes<Vec>);                 \
+    BENCHMARK_TEMPLATE(BM_insert_erase, Vec, at_middle)->Apply(sizes<Vec>);                \
+    BENCHMARK_TEMPLATE(BM_insert_erase, Vec, at_back)->Apply(sizes<Vec>);                  \
+    BENCHMARK_TEMPLATE(BM_assign, Vec)->Apply(sizes<Vec>);                                 \
+    BENCHMARK_TEMPLATE(BM_copy_construct, Vec)->Apply(sizes<Vec>);                         \
+    BENCHMARK_TEMPLATE(BM_move_construct, Vec)->Apply(sizes<Vec>);                         \
+    BENCHMARK_TEMPLATE(BM_resize, Vec)->Apply(sizes<Vec>);
+
+#endif // end of TSTL_BENCH_SRC_VECTOR_SUITE_H
@@ -0,0 +1,201 @@
+#ifndef TSTL_INCLUDE_TGP_ARENA_H
+#define TSTL_INCLUDE_TGP_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include <tgp/config.h>
+#include <tgp/exception.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a monotonic region carving allocations out of a chain of blocks, each twice as large as the one before.
+ * memory is given back all at once by reset or the destructor. deallocating the most recent allocation
+ * moves the bump pointer back, and the most recent allocation can grow in place while the block has room,
+ * so a vector growing at the top of the arena neither wastes nor copies anything.
+ */
+class arena {
+public:
+    /* begin of constructor and destructor */
+    explicit arena(const std::size_t initial_block_size = 4096) noexcept
+        : next_block_size_(std::max(initial_block_size, sizeof(block) * 2)) {}
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    ~arena() {
+        release_blocks(nullptr);
+    }
+    /* end of constructor and destructor */
+
+
+    /* begin of function members */
+    TGP_NODISCARD void* allocate(const std::size_t bytes, const std::size_t alignment = alignof(std::max_align_t)) {
+        TGP_PRECONDITION((alignment & (alignment - 1)) == 0);
+        if (!fits(bytes, alignment))
+            add_block(bytes + alignment);
+        char* p = align_up(ptr_, alignment);
+        ptr_ = p + bytes;
+        return p;
+    }
+
+    // only the most recent allocation is given back, everything else waits for reset
+    void deallocate(void* p, const std::size_t bytes) noexcept {
+        if (static_cast<char*>(p) + bytes == ptr_)
+            ptr_ = static_cast<char*>(p);
+    }
+
+    // grows the most recent allocation to new_bytes if the block has room for it
+    TGP_NODISCARD bool expand(void* p, const std::size_t bytes, const std::size_t new_bytes) noexcept {
+        char* const q = static_cast<char*>(p);
+        if (q + bytes != ptr_ || new_bytes > static_cast<std::size_t>(end_ - q))
+            return false;
+        ptr_ = q + new_bytes;
+        return true;
+    }
+
+    // frees all allocations at once, keeping the last block to serve the next round
+    void reset() noexcept {
+        if (head_) {
+            release_blocks(head_);
+            head_->prev = nullptr;
+            ptr_ = head_->data();
+        }
+    }
+
+    // bytes of the blocks the arena holds
+    TGP_NODISCARD std::size_t capacity() const noexcept {
+        std::size_t bytes = 0;
+        for (const block* b = head_; b; b = b->prev)
+            bytes += b->size;
+        return bytes;
+    }
+    /* end of function members */
+
+private:
+    /* begin of private data members and alias members */
+    struct block {
+        block*      prev;
+        std::size_t size;
+
+        char* data() noexcept {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    block*      head_ = nullptr;
+    char*       ptr_  = nullptr;
+    char*       end_  = nullptr;
+    std::size_t next_block_size_;
+    /* end of private data members and alias members */
+
+
+    /* begin of private function members */
+    TGP_NODISCARD static char* align_up(char* p, const std::size_t alignment) noexcept {
+        const auto address = reinterpret_cast<std::uintptr_t>(p);
+        return p + ((alignment - address % alignment) % alignment);
+    }
+
+    TGP_NODISCARD bool fits(const std::size_t bytes, const std::size_t alignment) const noexcept {
+        if (!ptr_)
+            return false;
+        const auto room    = static_cast<std::size_t>(end_ - ptr_);
+        const auto padding = static_cast<std::size_t>(align_up(ptr_, alignment) - ptr_);
+        return padding <= room && bytes <= room - padding;
+    }
+
+    void add_block(const std::size_t min_bytes) {
+        if (min_bytes > SIZE_MAX / 2 - sizeof(block))
+            TGP_TRY_THROW(std::bad_alloc());
+        const std::size_t size = std::max(next_block_size_, min_bytes + sizeof(block));
+        auto* b = static_cast<block*>(::operator new(size));
+        b->prev = head_;
+        b->size = size;
+        head_ = b;
+        ptr_  = b->data();
+        end_  = reinterpret_cast<char*>(b) + size;
+        next_block_size_ = size * 2;
+    }
+
+    // frees the blocks below keep, or all of them
+    void release_blocks(block* keep) noexcept {
+        block* b = keep ? keep->prev : head_;
+        while (b) {
+            block* prev = b->prev;
+            ::operator delete(b);
+            b = prev;
+        }
+    }
+    /* end of private function members */
+
+}; // end of class arena
+
+
+/*
+ * an allocator drawing from an arena. containers moved or swapped take the arena along with the buffer, so
+ * that both stay O(1); a copy-assigned container keeps its own arena and copies the elements into it.
+ */
+template<class T>
+class arena_allocator {
+public:
+    /* begin of public alias members */
+    using value_type                             = T;
+    using size_type                              = std::size_t;
+    using difference_type                        = std::ptrdiff_t;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+    /* end of public alias members */
+
+
+    /* begin of function members */
+    arena_allocator(arena& a) noexcept : arena_(&a) {}
+
+    template<class U>
+    arena_allocator(const arena_allocator<U>& other) noexcept : arena_(&other.resource()) {}
+
+    TGP_NODISCARD T* allocate(const size_type n) {
+        if (n > max_size())
+            TGP_TRY_THROW(std::bad_array_new_length());
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, const size_type n) noexcept {
+        arena_->deallocate(p, n * sizeof(T));
+    }
+
+    size_type expand_in_place(T* p, const size_type n, const size_type new_n) noexcept {
+        if (new_n > max_size() || !arena_->expand(p, n * sizeof(T), new_n * sizeof(T)))
+            return 0;
+        return new_n;
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return static_cast<size_type>(PTRDIFF_MAX) / sizeof(T);
+    }
+
+    TGP_NODISCARD arena& resource() const noexcept {
+        return *arena_;
+    }
+    /* end of function members */
+
+private:
+    /* begin of private data members */
+    arena* arena_;
+    /* end of private data members */
+
+}; // end of class arena_allocator
+
+template<class T, class U>
+TGP_NODISCARD bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) noexcept {
+    return &lhs.resource() == &rhs.resource();
+}
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_ARENA_H
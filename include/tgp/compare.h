@@ -2,20 +2,144 @@
 #define TSTL_INCLUDE_TGP_COMPARE_H
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#   include <immintrin.h>
+#   define TGP_HAS_X86_DISPATCH
+#endif
 
 #include <tgp/config.h>
 #include <tgp/has_range.h>
+#include <tgp/memory.h>
+#include <tgp/type_traits.h>
+
+#if TGP_STD_VER >= 20
+#   include <compare>
+#   include <concepts>
+#endif
 
 NAMESPACE_TGP_BEGIN
 
+/* begin of mismatch kernels */
+TGP_NODISCARD inline std::size_t mismatch_bytes_scalar(const unsigned char* a, const unsigned char* b,
+                                                       const std::size_t n) noexcept {
+    std::size_t i = 0;
+    while (i < n && a[i] == b[i])
+        ++i;
+    return i;
+}
+
+#ifdef TGP_HAS_X86_DISPATCH
+TGP_NODISCARD inline std::size_t mismatch_bytes_sse2(const unsigned char* a, const unsigned char* b,
+                                                     const std::size_t n) noexcept {
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        const auto equal = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+        if (equal != 0xffffu)
+            return i + static_cast<std::size_t>(__builtin_ctz(~equal));
+    }
+    return i + mismatch_bytes_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2")))
+TGP_NODISCARD inline std::size_t mismatch_bytes_avx2(const unsigned char* a, const unsigned char* b,
+                                                     const std::size_t n) noexcept {
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const auto equal = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+        if (equal != 0xffffffffu)
+            return i + static_cast<std::size_t>(__builtin_ctz(~equal));
+    }
+    return i + mismatch_bytes_sse2(a + i, b + i, n - i);
+}
+#endif
+
+// the index of the first byte where a and b differ, or n. picks the widest vector unit the cpu supports
+TGP_NODISCARD inline std::size_t mismatch_bytes(const unsigned char* a, const unsigned char* b,
+                                                const std::size_t n) noexcept {
+#ifdef TGP_HAS_X86_DISPATCH
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    return has_avx2 ? mismatch_bytes_avx2(a, b, n) : mismatch_bytes_sse2(a, b, n);
+#else
+    return mismatch_bytes_scalar(a, b, n);
+#endif
+}
+/* end of mismatch kernels */
+
+
+/* begin of contiguous comparisons */
+template<class Iter>
+using iter_value_t = std::remove_cv_t<typename std::iterator_traits<Iter>::value_type>;
+
+// ranges over contiguous integers of the same type, whose values are equal exactly when their bytes are
+template<class T, class U, class = void>
+struct is_bytewise_comparable_range : std::false_type {};
+
+template<class T, class U>
+struct is_bytewise_comparable_range<T, U, void_t<decltype(std::declval<const T&>().begin()),
+                                                 decltype(std::declval<const U&>().begin())>>
+    : bool_constant<is_contiguous_iterator_v<decltype(std::declval<const T&>().begin())> &&
+                    is_contiguous_iterator_v<decltype(std::declval<const U&>().begin())> &&
+                    is_same_v<iter_value_t<decltype(std::declval<const T&>().begin())>,
+                              iter_value_t<decltype(std::declval<const U&>().begin())>> &&
+                    std::is_integral_v<iter_value_t<decltype(std::declval<const T&>().begin())>>> {};
+
+template<class T, class U>
+inline constexpr bool is_bytewise_comparable_range_v = is_bytewise_comparable_range<T, U>::value;
+
+// compares like memcmp, which orders unsigned bytes the way the elements are ordered
+template<class T>
+TGP_NODISCARD int compare_contiguous(const T* a, const std::size_t na, const T* b, const std::size_t nb) noexcept {
+    const std::size_t n = std::min(na, nb);
+    if (n > 0) {
+        if constexpr (sizeof(T) == 1 && std::is_unsigned_v<T>) {
+            if (const int result = std::memcmp(a, b, n))
+                return result;
+        } else {
+            const std::size_t i = mismatch_bytes(reinterpret_cast<const unsigned char*>(a),
+                                                 reinterpret_cast<const unsigned char*>(b), n * sizeof(T)) / sizeof(T);
+            if (i < n)
+                return a[i] < b[i] ? -1 : 1;
+        }
+    }
+    return na < nb ? -1 : (na > nb ? 1 : 0);
+}
+
+template<class T, class U>
+TGP_NODISCARD int compare_contiguous(const T& lhs, const U& rhs) noexcept {
+    return compare_contiguous(tgp::to_address(lhs.begin()), static_cast<std::size_t>(lhs.end() - lhs.begin()),
+                              tgp::to_address(rhs.begin()), static_cast<std::size_t>(rhs.end() - rhs.begin()));
+}
+/* end of contiguous comparisons */
+
+
 template<class T, class U, enable_if_t<has_range_and_size_v<T> && has_range_and_size_v<U>, int> = 0>
 TGP_NODISCARD bool operator==(const T& lhs, const U& rhs) {
-    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    if (lhs.size() != rhs.size())
+        return false;
+    if constexpr (is_bytewise_comparable_range_v<T, U>) {
+        return lhs.size() == 0 ||
+               std::memcmp(tgp::to_address(lhs.begin()), tgp::to_address(rhs.begin()),
+                           lhs.size() * sizeof(iter_value_t<decltype(lhs.begin())>)) == 0;
+    } else {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
 }
 
 template<class T, class U, enable_if_t<has_range_v<T> && has_range_v<U>, int> = 0>
 TGP_NODISCARD bool operator<(const T& lhs, const U& rhs) {
-    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    if constexpr (is_bytewise_comparable_range_v<T, U>)
+        return compare_contiguous(lhs, rhs) < 0;
+    else
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
 template<class T, class U>
@@ -23,6 +147,48 @@ TGP_NODISCARD bool operator!=(const T& lhs, const U& rhs) {
     return !(lhs == rhs);
 }
 
+#if defined(__cpp_lib_three_way_comparison)
+// the element comparison of operator<=>, falling back to operator< for elements without operator<=>
+struct synth_three_way {
+    template<class T, class U>
+    TGP_NODISCARD constexpr auto operator()(const T& lhs, const U& rhs) const {
+        if constexpr (std::three_way_comparable_with<T, U>) {
+            return lhs <=> rhs;
+        } else {
+            if (lhs < rhs)
+                return std::weak_ordering::less;
+            if (rhs < lhs)
+                return std::weak_ordering::greater;
+            return std::weak_ordering::equivalent;
+        }
+    }
+};
+
+// compares in a single pass, the relational operators below share it
+template<class T, class U, enable_if_t<has_range_v<T> && has_range_v<U>, int> = 0>
+TGP_NODISCARD auto operator<=>(const T& lhs, const U& rhs) {
+    if constexpr (is_bytewise_comparable_range_v<T, U>)
+        return compare_contiguous(lhs, rhs) <=> 0;
+    else
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                                      synth_three_way());
+}
+
+template<class T, class U>
+TGP_NODISCARD bool operator>(const T& lhs, const U& rhs) {
+    return std::is_gt(lhs <=> rhs);
+}
+
+template<class T, class U>
+TGP_NODISCARD bool operator>=(const T& lhs, const U& rhs) {
+    return std::is_gteq(lhs <=> rhs);
+}
+
+template<class T, class U>
+TGP_NODISCARD bool operator<=(const T& lhs, const U& rhs) {
+    return std::is_lteq(lhs <=> rhs);
+}
+#else
 template<class T, class U>
 TGP_NODISCARD bool operator>(const T& lhs, const U& rhs) {
     return rhs < lhs;
@@ -37,6 +203,7 @@ template<class T, class U>
 TGP_NODISCARD bool operator<=(const T& lhs, const U& rhs) {
     return !(rhs < lhs);
 }
+#endif
 
 NAMESPACE_TGP_END
 
@@ -0,0 +1,498 @@
+#ifndef TSTL_INCLUDE_TGP_CONCURRENT_VECTOR_H
+#define TSTL_INCLUDE_TGP_CONCURRENT_VECTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <tgp/config.h>
+#include <tgp/exception.h>
+#include <tgp/vector.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a sequence many threads may append to at once, whose elements never move. it stores them in segments of
+ * 64, 128, 256, ... elements that are allocated on first use and never freed before clear, so references
+ * stay valid while the sequence grows and operator[] finds the segment of an index with one bit scan.
+ * appending reserves indices with a single fetch_add and publishes new segments with a compare-exchange,
+ * no lock is taken. size() counts the longest prefix of indices whose appends have finished, so at(), begin()
+ * and end() only reach published elements while other threads keep appending; an append that finishes ahead
+ * of an earlier one flags its slot for the thread that catches up. the appending thread may use its own index
+ * or reference right away.
+ * an append that throws flags its indices as a hole, which size() counts and iteration skips; the
+ * iterators are bidirectional for that reason.
+ * clear and destruction must not race with anything else, and the allocator is called concurrently.
+ */
+template<class T, class Allocator = std::allocator<T>>
+class concurrent_vector {
+    static_assert(is_same_v<T, typename Allocator::value_type>);
+
+    template<bool Const>
+    class basic_iterator;
+
+public:
+    /* begin of public alias members */
+    using value_type                = T;
+    using allocator_type            = Allocator;
+    using size_type                 = size_t;
+    using difference_type           = ptrdiff_t;
+    using reference                 = value_type&;
+    using const_reference           = const value_type&;
+    using pointer                   = value_type*;
+    using const_pointer             = const value_type*;
+    using iterator                  = basic_iterator<false>;
+    using const_iterator            = basic_iterator<true>;
+    using reverse_iterator          = std::reverse_iterator<iterator>;
+    using const_reverse_iterator    = std::reverse_iterator<const_iterator>;
+    /* end of public alias members */
+
+
+    /* begin of constructor and destructor */
+    concurrent_vector() noexcept(noexcept(allocator_type()))
+        : concurrent_vector(allocator_type()) {}
+
+    explicit concurrent_vector(const allocator_type& alloc) noexcept
+        : alloc_(alloc) {}
+
+    concurrent_vector(const concurrent_vector&) = delete;
+    concurrent_vector& operator=(const concurrent_vector&) = delete;
+
+    ~concurrent_vector() {
+        clear();
+    }
+    /* end of constructor and destructor */
+
+
+    /* begin of element access */
+    TGP_NODISCARD reference operator[] (const size_type pos) noexcept {
+        return *element(pos);
+    }
+
+    TGP_NODISCARD const_reference operator[] (const size_type pos) const noexcept {
+        return *element(pos);
+    }
+
+    // throws for indices not yet published and for holes
+    TGP_NODISCARD reference at(const size_type pos) {
+        if (pos >= size() || is_hole(pos))
+            TGP_TRY_THROW(std::out_of_range("tgp::concurrent_vector::at element access out of range"));
+        return *element(pos);
+    }
+
+    TGP_NODISCARD const_reference at(const size_type pos) const {
+        if (pos >= size() || is_hole(pos))
+            TGP_TRY_THROW(std::out_of_range("tgp::concurrent_vector::at element access out of range"));
+        return *element(pos);
+    }
+    /* end of element access */
+
+
+    /* begin of iterators */
+    TGP_NODISCARD iterator begin() noexcept {
+        return iterator(this, skip_holes(0));
+    }
+
+    TGP_NODISCARD const_iterator begin() const noexcept {
+        return const_iterator(this, skip_holes(0));
+    }
+
+    TGP_NODISCARD const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    TGP_NODISCARD iterator end() noexcept {
+        return iterator(this, skip_holes(size()));
+    }
+
+    TGP_NODISCARD const_iterator end() const noexcept {
+        return const_iterator(this, skip_holes(size()));
+    }
+
+    TGP_NODISCARD const_iterator cend() const noexcept {
+        return end();
+    }
+
+    TGP_NODISCARD reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    TGP_NODISCARD const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    TGP_NODISCARD reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    TGP_NODISCARD bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    // the published indices, holes included
+    TGP_NODISCARD size_type size() const noexcept {
+        return published_.load(std::memory_order_acquire);
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return std::min<size_type>(segment_base(segment_count - 1),
+                                   std::allocator_traits<allocator_type>::max_size(alloc_));
+    }
+
+    // allocates the segments holding the first new_cap elements, may run concurrently with appends
+    void reserve(const size_type new_cap) {
+        if (new_cap > max_size())
+            TGP_TRY_THROW(std::length_error("tgp::concurrent_vector::reserve new capacity exceeds max_size"));
+        if (new_cap > 0) {
+            for (size_type k = 0; k <= segment_of(new_cap - 1); ++k)
+                segment(k);
+        }
+    }
+    /* end of capacity */
+
+
+    /* begin of modifiers */
+    template<class... Args>
+    reference emplace_back(Args&&... args) {
+        const size_type pos = size_.fetch_add(1, std::memory_order_acq_rel);
+        value_type* p = nullptr;
+        TGP_TRY {
+            p = slot(pos);
+            std::allocator_traits<allocator_type>::construct(alloc_, p, std::forward<Args>(args)...);
+        } TGP_CATCH (...) {
+            add_hole(pos, 1);
+            TGP_THROW;
+        }
+        publish(pos, 1);
+        return *p;
+    }
+
+    reference push_back(const value_type& value) {
+        return emplace_back(value);
+    }
+
+    reference push_back(value_type&& value) {
+        return emplace_back(std::move(value));
+    }
+
+    // appends count value-initialized elements at consecutive indices, returns the index of the first
+    size_type grow_by(const size_type count) {
+        return grow_by_impl(count, [this](value_type* p) {
+            std::allocator_traits<allocator_type>::construct(alloc_, p);
+        });
+    }
+
+    size_type grow_by(const size_type count, const value_type& value) {
+        return grow_by_impl(count, [this, &value](value_type* p) {
+            std::allocator_traits<allocator_type>::construct(alloc_, p, value);
+        });
+    }
+
+    // destroys the elements and frees the segments
+    void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type> ||
+                      !allocator_has_trivial_destroy_v<allocator_type, value_type>) {
+            const size_type n = size_.load(std::memory_order_relaxed);
+            for (size_type k = 0; k < segment_count && segment_base(k) < n; ++k) {
+                // a segment is allocated after its flags, so every hole in it is flagged
+                value_type* const seg = segments_[k].load(std::memory_order_relaxed);
+                if (!seg)
+                    continue;
+                const unsigned char* const flags = flags_[k].load(std::memory_order_relaxed);
+                const size_type len = std::min(segment_size(k), n - segment_base(k));
+                for (size_type i = 0; i != len; ++i) {
+                    if (flags[i] != hole_flag)
+                        std::allocator_traits<allocator_type>::destroy(alloc_, seg + i);
+                }
+            }
+        }
+        for (size_type k = 0; k < segment_count; ++k) {
+            if (value_type* seg = segments_[k].exchange(nullptr, std::memory_order_relaxed))
+                std::allocator_traits<allocator_type>::deallocate(alloc_, seg, segment_size(k));
+            if (unsigned char* flags = flags_[k].exchange(nullptr, std::memory_order_relaxed)) {
+                flag_allocator_type flag_alloc(alloc_);
+                std::allocator_traits<flag_allocator_type>::deallocate(flag_alloc, flags, segment_size(k));
+            }
+        }
+        unflagged_holes_.clear();
+        unflagged_hole_count_.store(0, std::memory_order_relaxed);
+        size_.store(0, std::memory_order_relaxed);
+        published_.store(0, std::memory_order_relaxed);
+    }
+    /* end of modifiers */
+
+
+    /* begin of miscellaneous */
+    TGP_NODISCARD allocator_type get_allocator() const noexcept {
+        return alloc_;
+    }
+    /* end of miscellaneous */
+
+private:
+    /* begin of private data members and alias members */
+    // the first segment holds first_segment_size elements and each of the others as many as all before it
+    static constexpr size_type first_segment_size = 64;
+    static constexpr size_type segment_count      = sizeof(size_type) * 8 - std::bit_width(first_segment_size) + 1;
+
+    using flag_allocator_type = typename std::allocator_traits<allocator_type>::template rebind_alloc<unsigned char>;
+
+    // the values of a flag: the slot is not finished or was published right away, its element is constructed
+    // and waits to be published, or it belongs to an append that threw and holds no element
+    static constexpr unsigned char pending_flag     = 0;
+    static constexpr unsigned char constructed_flag = 1;
+    static constexpr unsigned char hole_flag        = 2;
+
+    std::atomic<value_type*>    segments_[segment_count] = {};
+    // one per slot of the segment, allocated before the segment
+    std::atomic<unsigned char*> flags_[segment_count] = {};
+    // the indices handed out, and the longest prefix of them whose appends have finished
+    std::atomic<size_type>      size_{0};
+    std::atomic<size_type>      published_{0};
+    allocator_type              alloc_;
+    // the holes [first, last) whose flags could not be allocated, they are flagged once another thread
+    // allocates them. only an allocation failure gets here, so this is the one place that takes a lock
+    std::mutex                  unflagged_holes_mutex_;
+    vector<std::pair<size_type, size_type>> unflagged_holes_;
+    std::atomic<size_type>      unflagged_hole_count_{0};
+    /* end of private data members and alias members */
+
+
+    /* begin of private function members */
+    TGP_NODISCARD static constexpr size_type segment_of(const size_type pos) noexcept {
+        return static_cast<size_type>(std::bit_width(pos / first_segment_size + 1)) - 1;
+    }
+
+    TGP_NODISCARD static constexpr size_type segment_base(const size_type k) noexcept {
+        return first_segment_size * ((size_type(1) << k) - 1);
+    }
+
+    TGP_NODISCARD static constexpr size_type segment_size(const size_type k) noexcept {
+        return first_segment_size << k;
+    }
+
+    TGP_NODISCARD value_type* element(const size_type pos) const noexcept {
+        const size_type k = segment_of(pos);
+        return segments_[k].load(std::memory_order_acquire) + (pos - segment_base(k));
+    }
+
+    // the storage of pos, allocating its segment if no thread has done so yet
+    TGP_NODISCARD value_type* slot(const size_type pos) {
+        const size_type k = segment_of(pos);
+        return segment(k) + (pos - segment_base(k));
+    }
+
+    value_type* segment(const size_type k) {
+        value_type* seg = segments_[k].load(std::memory_order_acquire);
+        if (seg)
+            return seg;
+        segment_flags(k);
+        value_type* fresh = std::allocator_traits<allocator_type>::allocate(alloc_, segment_size(k));
+        if (segments_[k].compare_exchange_strong(seg, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+            return fresh;
+        // another thread won the race
+        std::allocator_traits<allocator_type>::deallocate(alloc_, fresh, segment_size(k));
+        return seg;
+    }
+
+    // the flags of segment k, allocating them if no thread has done so yet
+    unsigned char* segment_flags(const size_type k) {
+        unsigned char* flags = flags_[k].load(std::memory_order_acquire);
+        if (flags)
+            return flags;
+        flag_allocator_type flag_alloc(alloc_);
+        unsigned char* fresh = std::allocator_traits<flag_allocator_type>::allocate(flag_alloc, segment_size(k));
+        std::memset(fresh, pending_flag, segment_size(k));
+        if (!flags_[k].compare_exchange_strong(flags, fresh, std::memory_order_seq_cst)) {
+            std::allocator_traits<flag_allocator_type>::deallocate(flag_alloc, fresh, segment_size(k));
+            return flags;
+        }
+        // seq_cst with the count in record_unflagged_hole, so that a hole waiting for these flags gets them
+        if (unflagged_hole_count_.load(std::memory_order_seq_cst) != 0) {
+            flag_unflagged_holes();
+            publish();
+        }
+        return fresh;
+    }
+
+    template<class Construct>
+    size_type grow_by_impl(const size_type count, Construct construct) {
+        const size_type first = size_.fetch_add(count, std::memory_order_acq_rel);
+        size_type pos = first;
+        TGP_TRY {
+            for (; pos != first + count; ++pos)
+                construct(slot(pos));
+        } TGP_CATCH (...) {
+            while (pos != first)
+                std::allocator_traits<allocator_type>::destroy(alloc_, element(--pos));
+            add_hole(first, count);
+            TGP_THROW;
+        }
+        publish(first, count);
+        return first;
+    }
+
+    // publishes [first, first + count) at once if they come next, and otherwise flags them for the thread
+    // that publishes the indices before them. seq_cst on the flags and published_, so that of
+    // two threads finishing neighbouring indices at once, at least one sees the other's done
+    void publish(const size_type first, const size_type count) noexcept {
+        size_type expected = first;
+        if (!published_.compare_exchange_strong(expected, first + count, std::memory_order_seq_cst)) {
+            for (size_type pos = first; pos != first + count; ++pos) {
+                const size_type k = segment_of(pos);
+                std::atomic_ref<unsigned char>(flags_[k].load(std::memory_order_acquire)[pos - segment_base(k)])
+                    .store(constructed_flag, std::memory_order_seq_cst);
+            }
+        }
+        publish();
+    }
+
+    TGP_NODISCARD unsigned char flag(const size_type pos, const std::memory_order order) const noexcept {
+        const size_type k = segment_of(pos);
+        unsigned char* const flags = flags_[k].load(std::memory_order_acquire);
+        return flags ? std::atomic_ref<unsigned char>(flags[pos - segment_base(k)]).load(order) : pending_flag;
+    }
+
+    // moves published_ over the indices whose appends have finished, any thread may take a step
+    void publish() noexcept {
+        size_type pos = published_.load(std::memory_order_seq_cst);
+        while (pos < size_.load(std::memory_order_acquire) &&
+               flag(pos, std::memory_order_seq_cst) != pending_flag) {
+            // on failure pos is reloaded with the progress of another thread
+            if (published_.compare_exchange_weak(pos, pos + 1, std::memory_order_seq_cst))
+                ++pos;
+        }
+    }
+
+    void add_hole(const size_type first, const size_type count) noexcept {
+        for (size_type pos = first; pos != first + count; ++pos) {
+            const size_type k = segment_of(pos);
+            unsigned char* flags = nullptr;
+            TGP_TRY {
+                flags = segment_flags(k);
+            } TGP_CATCH (...) {
+                record_unflagged_hole(pos, first + count);
+                break;
+            }
+            std::atomic_ref<unsigned char>(flags[pos - segment_base(k)]).store(hole_flag, std::memory_order_seq_cst);
+        }
+        publish();
+    }
+
+    void record_unflagged_hole(const size_type first, const size_type last) noexcept {
+        {
+            std::lock_guard<std::mutex> lock(unflagged_holes_mutex_);
+            TGP_TRY {
+                unflagged_holes_.emplace_back(first, last);
+            } TGP_CATCH (...) {
+                // without a record the published indices would stop at the hole
+                std::terminate();
+            }
+            unflagged_hole_count_.store(unflagged_holes_.size(), std::memory_order_seq_cst);
+        }
+        // another thread may have allocated the flags in the meantime
+        flag_unflagged_holes();
+    }
+
+    // flags the recorded holes as far as their flags are allocated
+    void flag_unflagged_holes() noexcept {
+        std::lock_guard<std::mutex> lock(unflagged_holes_mutex_);
+        for (auto& [first, last] : unflagged_holes_) {
+            for (; first != last; ++first) {
+                const size_type k = segment_of(first);
+                unsigned char* const flags = flags_[k].load(std::memory_order_seq_cst);
+                if (!flags)
+                    break;
+                std::atomic_ref<unsigned char>(flags[first - segment_base(k)])
+                    .store(hole_flag, std::memory_order_seq_cst);
+            }
+        }
+        erase_if(unflagged_holes_, [](const auto& hole) { return hole.first == hole.second; });
+        unflagged_hole_count_.store(unflagged_holes_.size(), std::memory_order_seq_cst);
+    }
+
+    TGP_NODISCARD bool is_hole(const size_type pos) const noexcept {
+        return flag(pos, std::memory_order_acquire) == hole_flag;
+    }
+
+    // the first index from pos on that is not in a hole
+    TGP_NODISCARD size_type skip_holes(size_type pos) const noexcept {
+        while (is_hole(pos))
+            ++pos;
+        return pos;
+    }
+
+    // the last index before pos that is not in a hole, or past the front if there is none
+    TGP_NODISCARD size_type skip_holes_back(size_type pos) const noexcept {
+        --pos;
+        while (pos != static_cast<size_type>(-1) && is_hole(pos))
+            --pos;
+        return pos;
+    }
+    /* end of private function members */
+
+}; // end of class concurrent_vector
+
+
+/* begin of concurrent_vector iterator */
+template<class T, class Allocator>
+template<bool Const>
+class concurrent_vector<T, Allocator>::basic_iterator {
+    using container = conditional_t<Const, const concurrent_vector, concurrent_vector>;
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = T;
+    using difference_type   = ptrdiff_t;
+    using pointer           = conditional_t<Const, const T*, T*>;
+    using reference         = conditional_t<Const, const T&, T&>;
+
+    basic_iterator() noexcept = default;
+
+    basic_iterator(container* c, const size_type pos) noexcept : c_(c), pos_(pos) {}
+
+    template<bool C = Const, enable_if_t<C, int> = 0>
+    basic_iterator(const basic_iterator<false>& other) noexcept : c_(other.c_), pos_(other.pos_) {}
+
+    TGP_NODISCARD reference operator*() const noexcept { return (*c_)[pos_]; }
+    TGP_NODISCARD pointer operator->() const noexcept { return std::addressof((*c_)[pos_]); }
+
+    basic_iterator& operator++() noexcept { pos_ = c_->skip_holes(pos_ + 1); return *this; }
+    basic_iterator operator++(int) noexcept { basic_iterator tmp = *this; ++*this; return tmp; }
+    basic_iterator& operator--() noexcept { pos_ = c_->skip_holes_back(pos_); return *this; }
+    basic_iterator operator--(int) noexcept { basic_iterator tmp = *this; --*this; return tmp; }
+
+    TGP_NODISCARD friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    // the index of the element, for random access through operator[]
+    TGP_NODISCARD size_type index() const noexcept {
+        return pos_;
+    }
+
+private:
+    friend class basic_iterator<!Const>;
+
+    container* c_   = nullptr;
+    size_type  pos_ = 0;
+};
+/* end of concurrent_vector iterator */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_CONCURRENT_VECTOR_H
@@ -1,7 +1,8 @@
 #ifndef TSTL_INCLUDE_TGP_CONFIG_H
 #define TSTL_INCLUDE_TGP_CONFIG_H
 
-#include <cassert>
+#include <cstdio>
+#include <cstdlib>
 #include <type_traits>
 
 
@@ -104,6 +105,36 @@
 #   define TGP_LIKELY
 #   define TGP_UNLIKELY
 #endif
+
+// a branch hint and a trap, msvc has neither builtin. __debugbreak returns when a debugger continues, so abort follows
+#if defined(_MSC_VER) && !defined(__clang__)
+#   define TGP_EXPECT_TRUE(cond) static_cast<bool>(cond)
+#   define TGP_TRAP()            (__debugbreak(), std::abort())
+#else
+#   define TGP_EXPECT_TRUE(cond) __builtin_expect(static_cast<bool>(cond), 1)
+#   define TGP_TRAP()            __builtin_trap()
+#endif
+
+// is_constant_evaluated
+#if TGP_STD_VER >= 20
+#   define TGP_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#else
+#   define TGP_IS_CONSTANT_EVALUATED() false
+#endif
+
+// no_unique_address, msvc ignores the standard spelling
+#if defined(__has_cpp_attribute) && __has_cpp_attribute(msvc::no_unique_address)
+#   define TGP_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#elif defined(__has_cpp_attribute) && __has_cpp_attribute(no_unique_address)
+#   define TGP_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#else
+#   define TGP_NO_UNIQUE_ADDRESS
+#endif
+
+// two data members of which the second, typically an allocator, takes no room when it is empty
+#define TGP_COMPRESSED_PAIR(T1, name1, T2, name2) \
+    T1 name1;                                     \
+    TGP_NO_UNIQUE_ADDRESS T2 name2
 /* end of compatibility */
 
 
@@ -112,9 +143,67 @@
 #define NAMESPACE_TGP_BEGIN namespace tgp {
 #define NAMESPACE_TGP_END   }
 
-// invariant judgement
-#define TGP_PRECONDITION(cond)  assert(cond)
-#define TGP_POSTCONDITION(cond) assert(cond)
+// hardening modes, each one checking what the one before does and more. define TGP_HARDENING_MODE to one of them,
+// it is debug by default and none under NDEBUG. it selects different code for the same containers, so it has to be
+// defined the same way in every translation unit of a program
+#define TGP_HARDENING_MODE_NONE      0
+#define TGP_HARDENING_MODE_FAST      1
+#define TGP_HARDENING_MODE_EXTENSIVE 2
+#define TGP_HARDENING_MODE_DEBUG     3
+
+#ifndef TGP_HARDENING_MODE
+#   ifdef NDEBUG
+#       define TGP_HARDENING_MODE TGP_HARDENING_MODE_NONE
+#   else
+#       define TGP_HARDENING_MODE TGP_HARDENING_MODE_DEBUG
+#   endif
+#endif
+
+#if TGP_HARDENING_MODE < TGP_HARDENING_MODE_NONE || TGP_HARDENING_MODE > TGP_HARDENING_MODE_DEBUG
+#   error "TGP_HARDENING_MODE must be one of the TGP_HARDENING_MODE_* values"
+#endif
+
+// a failed check traps in place, which keeps it to one branch predicted not taken and no call. debug mode says which
+// check failed before aborting. a check of a disabled level expands to nothing and doesn't evaluate its condition
+#if TGP_HARDENING_MODE == TGP_HARDENING_MODE_DEBUG
+#   define TGP_HARDENING_CHECK(cond) \
+        (TGP_EXPECT_TRUE(cond) ? (void)0 : ::tgp::hardening_failure(__FILE__, __LINE__, #cond))
+#else
+#   define TGP_HARDENING_CHECK(cond) (TGP_EXPECT_TRUE(cond) ? (void)0 : TGP_TRAP())
+#endif
+
+// fast: operator[], front, back and pop_back stay in bounds, erased ranges are valid
+#if TGP_HARDENING_MODE >= TGP_HARDENING_MODE_FAST
+#   define TGP_ASSERT_VALID_ELEMENT_ACCESS(cond) TGP_HARDENING_CHECK(cond)
+#   define TGP_ASSERT_VALID_INPUT_RANGE(cond)    TGP_HARDENING_CHECK(cond)
+#else
+#   define TGP_ASSERT_VALID_ELEMENT_ACCESS(cond) ((void)0)
+#   define TGP_ASSERT_VALID_INPUT_RANGE(cond)    ((void)0)
+#endif
+
+// extensive: the other preconditions that take constant time to check
+#if TGP_HARDENING_MODE >= TGP_HARDENING_MODE_EXTENSIVE
+#   define TGP_PRECONDITION(cond) TGP_HARDENING_CHECK(cond)
+#else
+#   define TGP_PRECONDITION(cond) ((void)0)
+#endif
+
+// debug: preconditions that take linear time, like sortedness, and the containers' own postconditions
+#if TGP_HARDENING_MODE >= TGP_HARDENING_MODE_DEBUG
+#   define TGP_ASSERT_SEMANTIC_REQUIREMENT(cond) TGP_HARDENING_CHECK(cond)
+#   define TGP_POSTCONDITION(cond)               TGP_HARDENING_CHECK(cond)
+#else
+#   define TGP_ASSERT_SEMANTIC_REQUIREMENT(cond) ((void)0)
+#   define TGP_POSTCONDITION(cond)               ((void)0)
+#endif
+
+// containers count allocations and relocations (see tgp/stats.h) when TGP_ENABLE_STATS is defined. it changes
+// their layout, so it has to be defined the same way in every translation unit of a program
+#ifdef TGP_ENABLE_STATS
+#   define TGP_STATS_ONLY(...) __VA_ARGS__
+#else
+#   define TGP_STATS_ONLY(...)
+#endif
 
 // helper alias and variables for type_traits
 NAMESPACE_TGP_BEGIN
@@ -134,6 +223,12 @@ using enable_if_t = typename std::enable_if<B, T>::type;
 template<class T, class U>
 inline constexpr bool is_same_v = std::is_same<T, U>::value;
 
+// reports a failed hardening check of debug mode
+[[noreturn]] inline void hardening_failure(const char* file, const int line, const char* cond) noexcept {
+    std::fprintf(stderr, "%s:%d: tgp hardening check failed: %s\n", file, line, cond);
+    std::abort();
+}
+
 NAMESPACE_TGP_END
 /* end of customized stuff */
 
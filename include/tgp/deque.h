@@ -0,0 +1,667 @@
+#ifndef TSTL_INCLUDE_TGP_DEQUE_H
+#define TSTL_INCLUDE_TGP_DEQUE_H
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <tgp/config.h>
+#include <tgp/exception.h>
+#include <tgp/memory.h>
+#include <tgp/split_buffer.h>
+#include <tgp/type_traits.h>
+#include <tgp/compare.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a double-ended queue storing its elements in fixed-size blocks, so pushing and popping at either end never
+ * moves an element. the block pointers live in a split_buffer, which keeps spare room at both ends: a new block
+ * slides the map towards its free end or regrows it, and both only copy pointers.
+ * a block emptied by popping is kept as a spare and rotated to the other end when that end needs one, so a
+ * fifo queue running in a steady state allocates nothing. block_size is a power of two, which makes indexing
+ * a shift and a mask; iterators keep a pointer to the element and the end of its block, so advancing one only
+ * touches the map when it crosses into the next block.
+ */
+template<class T, class Allocator = std::allocator<T>>
+class deque {
+    static_assert(is_same_v<T, typename Allocator::value_type>);
+
+    template<bool Const>
+    class basic_iterator;
+
+public:
+    /* begin of public alias members */
+    using value_type                = T;
+    using allocator_type            = Allocator;
+    using size_type                 = size_t;
+    using difference_type           = ptrdiff_t;
+    using reference                 = value_type&;
+    using const_reference           = const value_type&;
+    using pointer                   = value_type*;
+    using const_pointer             = const value_type*;
+    using iterator                  = basic_iterator<false>;
+    using const_iterator            = basic_iterator<true>;
+    using reverse_iterator          = std::reverse_iterator<iterator>;
+    using const_reverse_iterator    = std::reverse_iterator<const_iterator>;
+
+    // elements per block, a block spans about a page
+    static constexpr size_type block_size = std::bit_floor(std::max<size_type>(4096 / sizeof(T), 16));
+    /* end of public alias members */
+
+
+    /* begin of constructor and destructor */
+    deque() noexcept(noexcept(allocator_type()))
+        : deque(allocator_type()) {}
+
+    explicit deque(const allocator_type& alloc) noexcept
+        : map_(map_allocator_type(alloc)), alloc_(alloc) {}
+
+    explicit deque(const size_type count, const allocator_type& alloc = allocator_type())
+        : deque(alloc) {
+        TGP_TRY {
+            append(count);
+        } TGP_CATCH (...) {
+            destroy_deque();
+            TGP_THROW;
+        }
+    }
+
+    deque(const size_type count, const value_type& value, const allocator_type& alloc = allocator_type())
+        : deque(alloc) {
+        TGP_TRY {
+            append(count, value);
+        } TGP_CATCH (...) {
+            destroy_deque();
+            TGP_THROW;
+        }
+    }
+
+    template<class InputIt, enable_if_t<has_input_iterator_category<InputIt>::value, int> = 0>
+    deque(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+        : deque(alloc) {
+        TGP_TRY {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        } TGP_CATCH (...) {
+            destroy_deque();
+            TGP_THROW;
+        }
+    }
+
+    deque(const deque& other)
+        : deque(other.begin(), other.end(), alloc_traits::select_on_container_copy_construction(other.alloc_)) {}
+
+    deque(const deque& other, const allocator_type& alloc)
+        : deque(other.begin(), other.end(), alloc) {}
+
+    deque(deque&& other) noexcept
+        : map_(map_allocator_type(other.alloc_)), start_(other.start_), finish_(other.finish_),
+          alloc_(std::move(other.alloc_)) {
+        map_.swap(other.map_);
+        other.start_ = other.finish_ = 0;
+    }
+
+    deque(deque&& other, const allocator_type& alloc)
+        : deque(alloc) {
+        if (alloc == other.alloc_) {
+            map_.swap(other.map_);
+            std::swap(start_, other.start_);
+            std::swap(finish_, other.finish_);
+        } else {
+            TGP_TRY {
+                for (auto& value : other)
+                    emplace_back(std::move(value));
+            } TGP_CATCH (...) {
+                destroy_deque();
+                TGP_THROW;
+            }
+        }
+    }
+
+    deque(std::initializer_list<value_type> init, const allocator_type& alloc = allocator_type())
+        : deque(init.begin(), init.end(), alloc) {}
+
+    ~deque() {
+        destroy_deque();
+    }
+    /* end of constructor and destructor */
+
+
+    /* begin of element access */
+    TGP_NODISCARD reference operator[] (const size_type pos) noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
+        return *slot(start_ + pos);
+    }
+
+    TGP_NODISCARD const_reference operator[] (const size_type pos) const noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
+        return *slot(start_ + pos);
+    }
+
+    TGP_NODISCARD reference at(const size_type pos) {
+        if (pos >= size())
+            TGP_TRY_THROW(std::out_of_range("tgp::deque::at element access out of range"));
+        return *slot(start_ + pos);
+    }
+
+    TGP_NODISCARD const_reference at(const size_type pos) const {
+        if (pos >= size())
+            TGP_TRY_THROW(std::out_of_range("tgp::deque::at element access out of range"));
+        return *slot(start_ + pos);
+    }
+
+    TGP_NODISCARD reference front() noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *slot(start_);
+    }
+
+    TGP_NODISCARD const_reference front() const noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *slot(start_);
+    }
+
+    TGP_NODISCARD reference back() noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *slot(finish_ - 1);
+    }
+
+    TGP_NODISCARD const_reference back() const noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *slot(finish_ - 1);
+    }
+    /* end of element access */
+
+
+    /* begin of iterators */
+    TGP_NODISCARD iterator begin() noexcept {
+        return make_iterator<iterator>(start_);
+    }
+
+    TGP_NODISCARD const_iterator begin() const noexcept {
+        return make_iterator<const_iterator>(start_);
+    }
+
+    TGP_NODISCARD const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    TGP_NODISCARD iterator end() noexcept {
+        return make_iterator<iterator>(finish_);
+    }
+
+    TGP_NODISCARD const_iterator end() const noexcept {
+        return make_iterator<const_iterator>(finish_);
+    }
+
+    TGP_NODISCARD const_iterator cend() const noexcept {
+        return end();
+    }
+
+    TGP_NODISCARD reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    TGP_NODISCARD const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    TGP_NODISCARD const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+
+    TGP_NODISCARD reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    TGP_NODISCARD bool empty() const noexcept {
+        return start_ == finish_;
+    }
+
+    TGP_NODISCARD size_type size() const noexcept {
+        return finish_ - start_;
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return std::min<size_type>(alloc_traits::max_size(alloc_), PTRDIFF_MAX / sizeof(value_type));
+    }
+
+    // frees the spare blocks, the map keeps its capacity
+    void shrink_to_fit() noexcept {
+        if (empty()) {
+            destroy_deque();
+            return;
+        }
+        while (start_ >= block_size)
+            pop_front_block();
+        while (back_spare() > block_size)
+            pop_back_block();
+    }
+    /* end of capacity */
+
+
+    /* begin of modifiers */
+    // keeps one block, positioned so that both ends can grow without allocating
+    void clear() noexcept {
+        destruct_at_end(0);
+        while (map_.size() > 1)
+            pop_back_block();
+        start_ = finish_ = map_.empty() ? 0 : block_size / 2;
+    }
+
+    template<class... Args>
+    reference emplace_back(Args&&... args) {
+        if (back_spare() < 2)
+            add_back_block();
+        value_type* p = slot(finish_);
+        alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+        ++finish_;
+        return *p;
+    }
+
+    void push_back(const value_type& value) {
+        emplace_back(value);
+    }
+
+    void push_back(value_type&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template<class... Args>
+    reference emplace_front(Args&&... args) {
+        if (start_ == 0)
+            add_front_block();
+        value_type* p = slot(start_ - 1);
+        alloc_traits::construct(alloc_, p, std::forward<Args>(args)...);
+        --start_;
+        return *p;
+    }
+
+    void push_front(const value_type& value) {
+        emplace_front(value);
+    }
+
+    void push_front(value_type&& value) {
+        emplace_front(std::move(value));
+    }
+
+    // a second spare block at the back is freed
+    void pop_back() noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        alloc_traits::destroy(alloc_, slot(--finish_));
+        if (back_spare() >= 2 * block_size)
+            pop_back_block();
+    }
+
+    // a second spare block at the front is freed
+    void pop_front() noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        alloc_traits::destroy(alloc_, slot(start_++));
+        if (start_ >= 2 * block_size)
+            pop_front_block();
+    }
+
+    void resize(const size_type count) {
+        if (count > size())
+            append(count - size());
+        else
+            destruct_at_end(count);
+    }
+
+    void resize(const size_type count, const value_type& value) {
+        if (count > size())
+            append(count - size(), value);
+        else
+            destruct_at_end(count);
+    }
+
+    void assign(const size_type count, const value_type& value) {
+        const size_type cur_size = size();
+        std::fill_n(begin(), std::min(count, cur_size), value);
+        if (count > cur_size)
+            append(count - cur_size, value);
+        else
+            destruct_at_end(count);
+    }
+
+    template<class InputIt, enable_if_t<has_input_iterator_category<InputIt>::value, int> = 0>
+    void assign(InputIt first, InputIt last) {
+        const size_type cur_size = size();
+        size_type n = 0;
+        for (iterator cur = begin(); n != cur_size && first != last; ++first, (void)++cur, ++n)
+            *cur = *first;
+        if (n == cur_size) {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        } else {
+            destruct_at_end(n);
+        }
+    }
+
+    void assign(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    void swap(deque& other) noexcept {
+        map_.swap(other.map_);
+        std::swap(start_, other.start_);
+        std::swap(finish_, other.finish_);
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+            using std::swap;
+            swap(alloc_, other.alloc_);
+        }
+    }
+    /* end of modifiers */
+
+
+    /* begin of miscellaneous */
+    TGP_NODISCARD allocator_type get_allocator() const noexcept {
+        return alloc_;
+    }
+
+    deque& operator=(const deque& other) {
+        if (this != std::addressof(other)) {
+            if (alloc_traits::propagate_on_container_copy_assignment::value) {
+                if (alloc_ != other.alloc_) {
+                    destroy_deque();
+                    map_type map(map_allocator_type(other.alloc_));
+                    map_.swap(map);
+                    alloc_ = other.alloc_;
+                }
+            }
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    deque& operator=(deque&& other)
+    noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+        if (alloc_ == other.alloc_ || alloc_traits::propagate_on_container_move_assignment::value) {
+            destroy_deque();
+            alloc_ = std::move(other.alloc_);
+            map_.swap(other.map_);
+            std::swap(start_, other.start_);
+            std::swap(finish_, other.finish_);
+        } else {
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+        return *this;
+    }
+
+    deque& operator=(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    TGP_NODISCARD bool invariants() const {
+        if (!map_.invariants())
+            return false;
+        if (map_.empty())
+            return start_ == 0 && finish_ == 0;
+        return start_ <= finish_ && finish_ < map_.size() * block_size;
+    }
+    /* end of miscellaneous */
+
+private:
+    /* begin of private data members and alias members */
+    using alloc_traits          = std::allocator_traits<allocator_type>;
+    using map_allocator_type    = typename alloc_traits::template rebind_alloc<value_type*>;
+    using map_type              = split_buffer<value_type*, map_allocator_type>;
+
+    static constexpr size_type block_shift = static_cast<size_type>(std::countr_zero(block_size));
+    static constexpr size_type block_mask  = block_size - 1;
+
+    // the blocks in [map_.begin_, map_.end_) are allocated, the elements occupy the positions
+    // [start_, finish_) counted from the first element of the first block. the block holding finish_ is
+    // allocated too, so end() and an iterator stepping onto it can always read its block pointer.
+    // pushing at one end never writes the position of the other, keeping the two free of false dependencies
+    map_type    map_;
+    size_type   start_ = 0;
+    TGP_COMPRESSED_PAIR(size_type, finish_ = 0, allocator_type, alloc_);
+    /* end of private data members and alias members */
+
+
+    /* begin of private function members */
+    TGP_NODISCARD value_type* slot(const size_type pos) const noexcept {
+        return map_.begin_[pos >> block_shift] + (pos & block_mask);
+    }
+
+    TGP_NODISCARD size_type back_spare() const noexcept {
+        return map_.size() * block_size - finish_;
+    }
+
+    template<class Iter>
+    TGP_NODISCARD Iter make_iterator(const size_type pos) const noexcept {
+        if (map_.empty())
+            return Iter();
+        value_type* const* node = map_.begin_ + (pos >> block_shift);
+        return Iter(node, *node + (pos & block_mask));
+    }
+
+    // gives the back a block, the spare block at the front if there is one
+    void add_back_block() {
+        if (start_ >= block_size) {
+            value_type* block = *map_.begin_;
+            map_.pop_front();
+            // the slot just freed at the front leaves room for sliding, so this doesn't allocate
+            map_.push_back(block);
+            start_  -= block_size;
+            finish_ -= block_size;
+            return;
+        }
+        value_type* block = alloc_traits::allocate(alloc_, block_size);
+        TGP_TRY {
+            map_.push_back(block);
+        } TGP_CATCH (...) {
+            alloc_traits::deallocate(alloc_, block, block_size);
+            TGP_THROW;
+        }
+    }
+
+    // gives the front a block, the spare block at the back if there is one. the first block of an empty map
+    // starts its elements in the middle
+    void add_front_block() {
+        if (back_spare() > block_size) {
+            value_type* block = *(map_.end_ - 1);
+            map_.pop_back();
+            map_.push_front(block);
+        } else {
+            value_type* block = alloc_traits::allocate(alloc_, block_size);
+            TGP_TRY {
+                map_.push_front(block);
+            } TGP_CATCH (...) {
+                alloc_traits::deallocate(alloc_, block, block_size);
+                TGP_THROW;
+            }
+            if (map_.size() == 1) {
+                start_ = finish_ = block_size / 2;
+                return;
+            }
+        }
+        start_  += block_size;
+        finish_ += block_size;
+    }
+
+    void pop_front_block() noexcept {
+        alloc_traits::deallocate(alloc_, *map_.begin_, block_size);
+        map_.pop_front();
+        start_  -= block_size;
+        finish_ -= block_size;
+    }
+
+    void pop_back_block() noexcept {
+        alloc_traits::deallocate(alloc_, *(map_.end_ - 1), block_size);
+        map_.pop_back();
+    }
+
+    // appends count elements block by block, keeping those of the blocks already filled if one throws
+    template<class... Args>
+    void append(size_type count, const Args&... args) {
+        if (count > max_size() - size())
+            TGP_TRY_THROW(std::length_error("tgp::deque size exceeds max_size"));
+        while (back_spare() <= count)
+            add_back_block();
+        while (count > 0) {
+            const size_type n = std::min(count, block_size - (finish_ & block_mask));
+            if constexpr (sizeof...(Args) == 0)
+                uninitialized_allocator_value_construct_n(alloc_, slot(finish_), n);
+            else
+                uninitialized_allocator_fill_n(alloc_, slot(finish_), n, args...);
+            finish_ += n;
+            count   -= n;
+        }
+    }
+
+    void destruct_at_end(const size_type new_size) noexcept {
+        if constexpr (!allocator_has_trivial_destroy_v<allocator_type, value_type> ||
+                      !std::is_trivially_destructible_v<value_type>) {
+            for (size_type pos = start_ + new_size; pos != finish_; ++pos)
+                alloc_traits::destroy(alloc_, slot(pos));
+        }
+        finish_ = start_ + new_size;
+    }
+
+    // destroys the elements and frees the blocks, the map keeps its buffer
+    void destroy_deque() noexcept {
+        destruct_at_end(0);
+        while (!map_.empty())
+            pop_back_block();
+        start_ = finish_ = 0;
+    }
+    /* end of private function members */
+
+}; // end of class deque
+
+
+/* begin of deque iterator */
+// the element, the end of its block and the block's slot in the map
+template<class T, class Allocator>
+template<bool Const>
+class deque<T, Allocator>::basic_iterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = ptrdiff_t;
+    using pointer           = conditional_t<Const, const T*, T*>;
+    using reference         = conditional_t<Const, const T&, T&>;
+
+    basic_iterator() noexcept = default;
+
+    basic_iterator(T* const* node, T* cur) noexcept : cur_(cur), last_(*node + block_size), node_(node) {}
+
+    template<bool C = Const, enable_if_t<C, int> = 0>
+    basic_iterator(const basic_iterator<false>& other) noexcept
+        : cur_(other.cur_), last_(other.last_), node_(other.node_) {}
+
+    TGP_NODISCARD reference operator*() const noexcept { return *cur_; }
+    TGP_NODISCARD pointer operator->() const noexcept { return cur_; }
+    TGP_NODISCARD reference operator[](const difference_type n) const noexcept { return *(*this + n); }
+
+    basic_iterator& operator++() noexcept {
+        if (++cur_ == last_) {
+            cur_  = *++node_;
+            last_ = cur_ + block_size;
+        }
+        return *this;
+    }
+
+    basic_iterator& operator--() noexcept {
+        if (cur_ == last_ - block_size) {
+            last_ = *--node_ + block_size;
+            cur_  = last_;
+        }
+        --cur_;
+        return *this;
+    }
+
+    basic_iterator operator++(int) noexcept { basic_iterator tmp = *this; ++*this; return tmp; }
+    basic_iterator operator--(int) noexcept { basic_iterator tmp = *this; --*this; return tmp; }
+
+    // an arithmetic shift and a mask split the offset into whole blocks and the index in the last one
+    basic_iterator& operator+=(const difference_type n) noexcept {
+        if (n == 0)
+            return *this;
+        const difference_type offset = index() + n;
+        if (offset >= 0 && offset < static_cast<difference_type>(block_size)) {
+            cur_ += n;
+        } else {
+            node_ += offset >> block_shift;
+            cur_   = *node_ + (static_cast<size_type>(offset) & block_mask);
+            last_  = *node_ + block_size;
+        }
+        return *this;
+    }
+
+    basic_iterator& operator-=(const difference_type n) noexcept { return *this += -n; }
+
+    TGP_NODISCARD friend basic_iterator operator+(basic_iterator it, const difference_type n) noexcept {
+        return it += n;
+    }
+
+    TGP_NODISCARD friend basic_iterator operator+(const difference_type n, basic_iterator it) noexcept {
+        return it += n;
+    }
+
+    TGP_NODISCARD friend basic_iterator operator-(basic_iterator it, const difference_type n) noexcept {
+        return it -= n;
+    }
+
+    TGP_NODISCARD friend difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        if (lhs.node_ == rhs.node_)
+            return lhs.cur_ - rhs.cur_;
+        return (lhs.node_ - rhs.node_) * static_cast<difference_type>(block_size) + (lhs.index() - rhs.index());
+    }
+
+    TGP_NODISCARD friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.cur_ == rhs.cur_;
+    }
+
+    TGP_NODISCARD friend auto operator<=>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        if (const auto order = lhs.node_ <=> rhs.node_; std::is_neq(order))
+            return order;
+        return lhs.cur_ <=> rhs.cur_;
+    }
+
+private:
+    friend class basic_iterator<!Const>;
+
+    TGP_NODISCARD difference_type index() const noexcept {
+        return cur_ - (last_ - block_size);
+    }
+
+    T*        cur_  = nullptr;
+    T*        last_ = nullptr;
+    T* const* node_ = nullptr;
+};
+/* end of deque iterator */
+
+NAMESPACE_TGP_END
+
+namespace std {
+
+template<class T, class Alloc>
+void swap(tgp::deque<T, Alloc>& lhs, tgp::deque<T, Alloc>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // end of namespace std
+
+#endif // end of TSTL_INCLUDE_TGP_DEQUE_H
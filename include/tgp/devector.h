@@ -0,0 +1,867 @@
+#ifndef TSTL_INCLUDE_TGP_DEVECTOR_H
+#define TSTL_INCLUDE_TGP_DEVECTOR_H
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include <tgp/config.h>
+#include <tgp/exception.h>
+#include <tgp/growth_policy.h>
+#include <tgp/memory.h>
+#include <tgp/split_buffer.h>
+#include <tgp/type_traits.h>
+#include <tgp/compare.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a contiguous sequence with free room at both ends, laid out like a split_buffer, so pushing and popping
+ * at the front is amortized O(1) just like at the back and data() is always one array.
+ * when an end runs out of room and the buffer is at most half full, the elements are recentered in place;
+ * otherwise the buffer grows through GrowthPolicy, the new room going to the end that ran out while the
+ * other end keeps its own. insert and erase in the middle shift whichever side holds fewer elements.
+ */
+template<class T, class Allocator = std::allocator<T>, class GrowthPolicy = double_growth>
+class devector {
+    static_assert(is_same_v<T, typename Allocator::value_type>);
+
+public:
+    /* begin of public alias members */
+    using value_type                = T;
+    using allocator_type            = Allocator;
+    using growth_policy             = GrowthPolicy;
+    using size_type                 = size_t;
+    using difference_type           = ptrdiff_t;
+    using reference                 = value_type&;
+    using const_reference           = const value_type&;
+    using pointer                   = typename std::allocator_traits<allocator_type>::pointer;
+    using const_pointer             = typename std::allocator_traits<allocator_type>::const_pointer;
+    using iterator                  = pointer;
+    using const_iterator            = const_pointer;
+    using reverse_iterator          = std::reverse_iterator<iterator>;
+    using const_reverse_iterator    = std::reverse_iterator<const_iterator>;
+    /* end of public alias members */
+
+
+    /* begin of constructor and destructor */
+    TGP_CONSTEXPR_SINCE_CXX20 devector() noexcept(noexcept(allocator_type()))
+        : devector(allocator_type()) {}
+
+    TGP_CONSTEXPR_SINCE_CXX20 explicit devector(const allocator_type& alloc) noexcept
+        : alloc_(alloc) {}
+
+    TGP_CONSTEXPR_SINCE_CXX20 explicit devector(const size_type count, const allocator_type& alloc = allocator_type())
+        : alloc_(alloc) {
+        if (count > 0) {
+            TGP_TRY {
+                allocate_devector(count);
+                construct_at_end(count);
+            } TGP_CATCH (...) {
+                destroy_devector();
+                TGP_THROW;
+            }
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20
+    devector(const size_type count, const value_type& value, const allocator_type& alloc = allocator_type())
+        : alloc_(alloc) {
+        if (count > 0) {
+            TGP_TRY {
+                allocate_devector(count);
+                construct_at_end(count, value);
+            } TGP_CATCH (...) {
+                destroy_devector();
+                TGP_THROW;
+            }
+        }
+    }
+
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    TGP_CONSTEXPR_SINCE_CXX20 devector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+        : alloc_(alloc) {
+        TGP_TRY {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        } TGP_CATCH (...) {
+            destroy_devector();
+            TGP_THROW;
+        }
+    }
+
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
+    TGP_CONSTEXPR_SINCE_CXX20 devector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+        : alloc_(alloc) {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        if (count > 0) {
+            TGP_TRY {
+                allocate_devector(count);
+                construct_at_end(first, last);
+            } TGP_CATCH (...) {
+                destroy_devector();
+                TGP_THROW;
+            }
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 devector(const devector& other)
+        : devector(other.begin(), other.end(),
+                   alloc_traits::select_on_container_copy_construction(other.get_allocator())) {}
+
+    TGP_CONSTEXPR_SINCE_CXX20 devector(const devector& other, const allocator_type& alloc)
+        : devector(other.begin(), other.end(), alloc) {}
+
+    TGP_CONSTEXPR_SINCE_CXX20 devector(devector&& other) noexcept
+        : first_(other.first_), begin_(other.begin_), end_(other.end_), cap_(other.cap_),
+          alloc_(std::move(other.alloc_)) {
+        other.first_ = other.begin_ = other.end_ = other.cap_ = nullptr;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 devector(devector&& other, const allocator_type& alloc)
+        : devector(alloc) {
+        if (alloc == other.get_allocator()) {
+            steal(other);
+        } else {
+            const size_type count = other.size();
+            if (count > 0) {
+                TGP_TRY {
+                    allocate_devector(count);
+                    construct_at_end(std::make_move_iterator(other.begin_), std::make_move_iterator(other.end_));
+                } TGP_CATCH (...) {
+                    destroy_devector();
+                    TGP_THROW;
+                }
+            }
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20
+    devector(std::initializer_list<value_type> init, const allocator_type& alloc = allocator_type())
+        : devector(init.begin(), init.end(), alloc) {}
+
+    TGP_CONSTEXPR_SINCE_CXX20 ~devector() {
+        destroy_devector();
+    }
+    /* end of constructor and destructor */
+
+
+    /* begin of element access */
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reference operator[] (const size_type pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
+        return begin_[pos];
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reference operator[] (const size_type pos) const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
+        return begin_[pos];
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reference at(const size_type pos) {
+        if (pos >= size())
+            TGP_TRY_THROW(std::out_of_range("tgp::devector::at element access out of range"));
+        return begin_[pos];
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reference at(const size_type pos) const {
+        if (pos >= size())
+            TGP_TRY_THROW(std::out_of_range("tgp::devector::at element access out of range"));
+        return begin_[pos];
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reference front() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *begin_;
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reference front() const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *begin_;
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reference back() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *(end_ - 1);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reference back() const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *(end_ - 1);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 value_type* data() noexcept {
+        return tgp::to_address(begin_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const value_type* data() const noexcept {
+        return tgp::to_address(begin_);
+    }
+    /* end of element access */
+
+
+    /* begin of iterators */
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 iterator begin() noexcept {
+        return iterator(begin_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_iterator begin() const noexcept {
+        return const_iterator(begin_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 iterator end() noexcept {
+        return iterator(end_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_iterator end() const noexcept {
+        return const_iterator(end_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_iterator cend() const noexcept {
+        return end();
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type capacity() const noexcept {
+        return static_cast<size_type>(cap_ - first_);
+    }
+
+    // the elements that fit in front of the first one without reallocating
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type front_free_capacity() const noexcept {
+        return static_cast<size_type>(begin_ - first_);
+    }
+
+    // the elements that fit behind the last one without reallocating
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type back_free_capacity() const noexcept {
+        return static_cast<size_type>(cap_ - end_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type max_size() const noexcept {
+        return alloc_traits::max_size(alloc_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type size() const noexcept {
+        return static_cast<size_type>(end_ - begin_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 bool empty() const noexcept {
+        return begin_ == end_;
+    }
+
+    // like vector::reserve, makes room for new_cap elements from the first one on
+    TGP_CONSTEXPR_SINCE_CXX20 void reserve(const size_type new_cap) {
+        reserve_back(new_cap);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void reserve_back(const size_type new_cap) {
+        if (new_cap > size() + back_free_capacity()) {
+            if (new_cap > max_size() - front_free_capacity())
+                TGP_TRY_THROW(std::length_error("tgp::devector::reserve_back demanding size exceeds max size"));
+            relayout(front_free_capacity() + new_cap, front_free_capacity());
+        }
+    }
+
+    // makes room for new_cap elements up to the last one
+    TGP_CONSTEXPR_SINCE_CXX20 void reserve_front(const size_type new_cap) {
+        if (new_cap > size() + front_free_capacity()) {
+            if (new_cap > max_size() - back_free_capacity())
+                TGP_TRY_THROW(std::length_error("tgp::devector::reserve_front demanding size exceeds max size"));
+            relayout(new_cap + back_free_capacity(), new_cap - size());
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void shrink_to_fit() {
+        if (capacity() > size()) {
+            if (empty()) {
+                destroy_devector();
+                first_ = begin_ = end_ = cap_ = nullptr;
+                return;
+            }
+            TGP_TRY {
+                relayout(size(), 0);
+            } TGP_CATCH (...) {
+
+            }
+        }
+    }
+    /* end of capacity */
+
+
+    /* begin of modifiers */
+    TGP_CONSTEXPR_SINCE_CXX20 void clear() noexcept {
+        destruct_at_end(begin_);
+    }
+
+    template<class... Args>
+    TGP_CONSTEXPR_SINCE_CXX20 reference emplace_back(Args&&... args) {
+        if (end_ == cap_) {
+            // args may refer to an element of this devector, so build the value before making room
+            temp_value<value_type, allocator_type> tmp(alloc_, std::forward<Args>(args)...);
+            make_room_at_back(1);
+            if constexpr (trivially_relocatable)
+                tmp.relocate_to(tgp::to_address(end_++));
+            else
+                construct_one_at_end(std::move(tmp.get()));
+        } else {
+            construct_one_at_end(std::forward<Args>(args)...);
+        }
+        return *(end_ - 1);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void push_back(const value_type& value) {
+        emplace_back(value);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void push_back(value_type&& value) {
+        emplace_back(std::move(value));
+    }
+
+    template<class... Args>
+    TGP_CONSTEXPR_SINCE_CXX20 reference emplace_front(Args&&... args) {
+        if (begin_ == first_) {
+            temp_value<value_type, allocator_type> tmp(alloc_, std::forward<Args>(args)...);
+            make_room_at_front(1);
+            if constexpr (trivially_relocatable)
+                tmp.relocate_to(tgp::to_address(--begin_));
+            else
+                construct_one_at_front(std::move(tmp.get()));
+        } else {
+            construct_one_at_front(std::forward<Args>(args)...);
+        }
+        return *begin_;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void push_front(const value_type& value) {
+        emplace_front(value);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void push_front(value_type&& value) {
+        emplace_front(std::move(value));
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void pop_back() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        destruct_at_end(end_ - 1);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void pop_front() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        alloc_traits::destroy(alloc_, tgp::to_address(begin_));
+        ++begin_;
+    }
+
+    template<class... Args>
+    TGP_CONSTEXPR_SINCE_CXX20 iterator emplace(const_iterator pos, Args&&... args) {
+        const auto index = static_cast<size_type>(pos - begin());
+        const size_type after = size() - index;
+        if (after == 0) {
+            emplace_back(std::forward<Args>(args)...);
+            return end_ - 1;
+        }
+        if (index == 0) {
+            emplace_front(std::forward<Args>(args)...);
+            return begin_;
+        }
+        temp_value<value_type, allocator_type> tmp(alloc_, std::forward<Args>(args)...);
+        if constexpr (trivially_relocatable) {
+            pointer p = open_gap(index, 1);
+            tmp.relocate_to(tgp::to_address(p));
+            return p;
+        } else {
+            // the nearer end grows by one element and the ones up to pos move over by one
+            if (index < after) {
+                emplace_front(std::move(*begin_));
+                std::move(begin_ + 2, begin_ + index + 1, begin_ + 1);
+            } else {
+                emplace_back(std::move(*(end_ - 1)));
+                std::move_backward(begin_ + index, end_ - 2, end_ - 1);
+            }
+            begin_[index] = std::move(tmp.get());
+            return begin_ + index;
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, const value_type& value) {
+        return emplace(pos, value);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, const size_type count, const value_type& value) {
+        const auto index = static_cast<size_type>(pos - begin());
+        if (count == 0)
+            return begin_ + index;
+        if (is_internal_element_ref(value)) {
+            const value_type copy(value);
+            return insert(begin() + index, count, copy);
+        }
+        return insert_n(index, count, [&](value_type* p) {
+            uninitialized_allocator_fill_n(alloc_, p, count, value);
+        });
+    }
+
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        const auto index = static_cast<size_type>(pos - begin());
+        const size_type cur_size = size();
+        for (; first != last; ++first)
+            emplace_back(*first);
+        std::rotate(begin_ + index, begin_ + cur_size, end_);
+        return begin_ + index;
+    }
+
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        const auto index = static_cast<size_type>(pos - begin());
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        if (count == 0)
+            return begin_ + index;
+        return insert_n(index, count, [&](value_type* p) {
+            uninitialized_allocator_copy(alloc_, first, last, p);
+        });
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 iterator erase(const_iterator pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos != end());
+        return erase(pos, pos + 1);
+    }
+
+    // closes the hole by moving whichever side of it holds fewer elements
+    TGP_CONSTEXPR_SINCE_CXX20 iterator erase(const_iterator first, const_iterator last) {
+        TGP_ASSERT_VALID_INPUT_RANGE(first <= last);
+        const auto index = static_cast<size_type>(first - begin());
+        pointer p = begin_ + index;
+        pointer q = p + (last - first);
+        if (p == q)
+            return p;
+        const bool shift_front = p - begin_ < end_ - q;
+        if constexpr (trivially_relocatable) {
+            allocator_destroy(alloc_, tgp::to_address(p), tgp::to_address(q));
+            if (shift_front) {
+                allocator_trivially_relocate(alloc_, tgp::to_address(begin_), tgp::to_address(p),
+                                             tgp::to_address(begin_ + (q - p)));
+                begin_ += (q - p);
+            } else {
+                allocator_trivially_relocate(alloc_, tgp::to_address(q), tgp::to_address(end_),
+                                             tgp::to_address(p));
+                end_ -= (q - p);
+            }
+        } else {
+            if (shift_front) {
+                pointer new_begin = std::move_backward(begin_, p, q);
+                allocator_destroy(alloc_, tgp::to_address(begin_), tgp::to_address(new_begin));
+                begin_ = new_begin;
+            } else {
+                destruct_at_end(std::move(q, end_, p));
+            }
+        }
+        return begin_ + index;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void resize(const size_type count) {
+        const size_type cur_size = size();
+        if (count <= cur_size) {
+            destruct_at_end(begin_ + count);
+        } else {
+            make_room_at_back(count - cur_size);
+            construct_at_end(count - cur_size);
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void resize(const size_type count, const value_type& value) {
+        const size_type cur_size = size();
+        if (count <= cur_size) {
+            destruct_at_end(begin_ + count);
+        } else if (is_internal_element_ref(value)) {
+            const value_type copy(value);
+            resize(count, copy);
+        } else {
+            make_room_at_back(count - cur_size);
+            construct_at_end(count - cur_size, value);
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void swap(devector& other)
+    noexcept(alloc_traits::propagate_on_container_swap::value || alloc_traits::is_always_equal::value) {
+        using std::swap;
+        swap(first_, other.first_);
+        swap(begin_, other.begin_);
+        swap(end_, other.end_);
+        swap(cap_, other.cap_);
+        if (alloc_traits::propagate_on_container_swap::value)
+            swap(alloc_, other.alloc_);
+    }
+    /* end of modifiers */
+
+
+    /* begin of miscellaneous */
+    TGP_CONSTEXPR_SINCE_CXX20 allocator_type get_allocator() const noexcept {
+        return alloc_;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 devector& operator=(const devector& other) {
+        if (this != std::addressof(other)) {
+            if (alloc_traits::propagate_on_container_copy_assignment::value) {
+                if (alloc_ != other.alloc_) {
+                    deallocate_devector();
+                    alloc_ = other.alloc_;
+                }
+            }
+            assign(other.begin_, other.end_);
+        }
+        return *this;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 devector& operator=(devector&& other)
+    noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+        if (alloc_ == other.alloc_ || alloc_traits::propagate_on_container_move_assignment::value) {
+            deallocate_devector();
+            alloc_ = std::move(other.alloc_);
+            steal(other);
+        } else {
+            assign(std::make_move_iterator(other.begin_), std::make_move_iterator(other.end_));
+        }
+        return *this;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 devector& operator=(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void assign(const size_type count, const value_type& value) {
+        if (is_internal_element_ref(value)) {
+            const value_type copy(value);
+            assign(count, copy);
+            return;
+        }
+        clear();
+        begin_ = end_ = first_;
+        if (count > capacity()) {
+            const size_type new_cap = recommend_cap(count);
+            deallocate_devector();
+            allocate_devector(new_cap);
+        }
+        construct_at_end(count, value);
+    }
+
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    TGP_CONSTEXPR_SINCE_CXX20 void assign(InputIt first, InputIt last) {
+        clear();
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
+    TGP_CONSTEXPR_SINCE_CXX20 void assign(InputIt first, InputIt last) {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        clear();
+        begin_ = end_ = first_;
+        if (count > capacity()) {
+            const size_type new_cap = recommend_cap(count);
+            deallocate_devector();
+            allocate_devector(new_cap);
+        }
+        construct_at_end(first, last);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void assign(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 bool invariants() const {
+        if (first_ == nullptr)
+            return begin_ == nullptr && end_ == nullptr && cap_ == nullptr;
+        return first_ <= begin_ && begin_ <= end_ && end_ <= cap_;
+    }
+    /* end of miscellaneous */
+
+private:
+    /* begin of private data members and alias members */
+    using alloc_traits = std::allocator_traits<allocator_type>;
+
+    static constexpr bool trivially_relocatable = is_trivially_allocator_relocatable_v<allocator_type, value_type>;
+
+    pointer first_ = nullptr;
+    pointer begin_ = nullptr;
+    pointer end_   = nullptr;
+    TGP_COMPRESSED_PAIR(pointer, cap_ = nullptr, allocator_type, alloc_);
+    /* end of private data members and alias members */
+
+
+    /* begin of private function members */
+    TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(const size_type n) {
+        uninitialized_allocator_value_construct_n(alloc_, tgp::to_address(end_), n);
+        end_ += n;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(const size_type n, const value_type& value) {
+        uninitialized_allocator_fill_n(alloc_, tgp::to_address(end_), n, value);
+        end_ += n;
+    }
+
+    template<class Iter>
+    TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(Iter first, Iter last) {
+        value_type* e = tgp::to_address(end_);
+        end_ += (uninitialized_allocator_copy(alloc_, first, last, e) - e);
+    }
+
+    template<class... Args>
+    TGP_CONSTEXPR_SINCE_CXX20 void construct_one_at_end(Args&&... args) {
+        alloc_traits::construct(alloc_, tgp::to_address(end_), std::forward<Args>(args)...);
+        ++end_;
+    }
+
+    template<class... Args>
+    TGP_CONSTEXPR_SINCE_CXX20 void construct_one_at_front(Args&&... args) {
+        alloc_traits::construct(alloc_, tgp::to_address(begin_ - 1), std::forward<Args>(args)...);
+        --begin_;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void destruct_at_end(pointer new_end) noexcept {
+        pointer soon_to_be_end = end_;
+        while (soon_to_be_end != new_end)
+            alloc_traits::destroy(alloc_, tgp::to_address(--soon_to_be_end));
+        end_ = new_end;
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type recommend_cap(const size_type new_size) const {
+        const size_type ms = max_size();
+        if (new_size > ms)
+            TGP_TRY_THROW(std::length_error("tgp::devector::recommend_cap demanding size exceeds max size"));
+        const size_type cap = growth_policy::recommend(capacity(), new_size, ms, sizeof(value_type));
+        TGP_POSTCONDITION(new_size <= cap && cap <= ms);
+        return cap;
+    }
+
+    // a buffer at most half full is recentered in place, which moves every element but frees at least as
+    // many slots as it moves, so pushing at one end and popping at the other stays amortized O(1)
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 bool can_recenter(const size_type n) const noexcept {
+        return size() + n <= capacity() / 2;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void make_room_at_back(const size_type n) {
+        if (back_free_capacity() >= n)
+            return;
+        if (can_recenter(n)) {
+            relayout(capacity(), (capacity() - size() - n) / 2);
+        } else {
+            if (n > max_size() - size() - front_free_capacity())
+                TGP_TRY_THROW(std::length_error("tgp::devector demanding size exceeds max size"));
+            relayout(recommend_cap(front_free_capacity() + size() + n), front_free_capacity());
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void make_room_at_front(const size_type n) {
+        if (front_free_capacity() >= n)
+            return;
+        if (can_recenter(n)) {
+            const size_type free = capacity() - size();
+            relayout(capacity(), free - (free - n) / 2);
+        } else {
+            if (n > max_size() - size() - back_free_capacity())
+                TGP_TRY_THROW(std::length_error("tgp::devector demanding size exceeds max size"));
+            const size_type new_cap = recommend_cap(back_free_capacity() + size() + n);
+            relayout(new_cap, new_cap - size() - back_free_capacity());
+        }
+    }
+
+    /*
+     * moves the elements into a buffer of new_cap elements, the first of them new_front slots from its start,
+     * and leaves an uninitialized gap of gap_n slots in front of the element at gap_index, which end_ covers.
+     * trivially relocatable elements stay in the same buffer if its capacity doesn't change, and only they
+     * may ask for a gap.
+     */
+    TGP_CONSTEXPR_SINCE_CXX20 void relayout(const size_type new_cap, const size_type new_front,
+                                            const size_type gap_index = 0, const size_type gap_n = 0) {
+        const size_type n = size();
+        if constexpr (trivially_relocatable) {
+            if (first_ != nullptr && new_cap == capacity()) {
+                pointer new_begin = first_ + new_front;
+                pointer mid = begin_ + gap_index;
+                // the piece moving further right goes first so that neither overwrites the other
+                if (new_begin >= begin_) {
+                    relocate(mid, end_, new_begin + gap_index + gap_n);
+                    relocate(begin_, mid, new_begin);
+                } else {
+                    relocate(begin_, mid, new_begin);
+                    relocate(mid, end_, new_begin + gap_index + gap_n);
+                }
+                begin_ = new_begin;
+                end_   = new_begin + n + gap_n;
+                return;
+            }
+        } else {
+            TGP_PRECONDITION(gap_n == 0);
+        }
+        split_buffer<value_type, allocator_type&> sb(new_cap, new_front, alloc_);
+        if constexpr (trivially_relocatable) {
+            pointer mid = begin_ + gap_index;
+            relocate(begin_, mid, sb.begin_);
+            relocate(mid, end_, sb.begin_ + gap_index + gap_n);
+        } else {
+            uninitialized_allocator_relocate(alloc_, tgp::to_address(begin_), tgp::to_address(end_),
+                                             tgp::to_address(sb.begin_));
+        }
+        sb.end_ = sb.begin_ + n + gap_n;
+        end_ = begin_;
+        using std::swap;
+        swap(first_, sb.first_);
+        swap(begin_, sb.begin_);
+        swap(end_, sb.end_);
+        swap(cap_, sb.cap_);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void relocate(pointer first, pointer last, pointer result) noexcept {
+        allocator_trivially_relocate(alloc_, tgp::to_address(first), tgp::to_address(last),
+                                     tgp::to_address(result));
+    }
+
+    /*
+     * opens an uninitialized gap of n slots in front of the element at index and returns it. the side holding
+     * fewer elements moves if its end has room, then the other side, and else the buffer is relaid out with
+     * the gap and the free room split evenly between the ends.
+     */
+    TGP_CONSTEXPR_SINCE_CXX20 pointer open_gap(const size_type index, const size_type n) {
+        static_assert(trivially_relocatable);
+        const bool front_room = front_free_capacity() >= n;
+        const bool back_room  = back_free_capacity() >= n;
+        if (front_room && (index <= size() - index || !back_room)) {
+            relocate(begin_, begin_ + index, begin_ - n);
+            begin_ -= n;
+        } else if (back_room) {
+            relocate(begin_ + index, end_, begin_ + index + n);
+            end_ += n;
+        } else {
+            if (n > max_size() - size())
+                TGP_TRY_THROW(std::length_error("tgp::devector demanding size exceeds max size"));
+            const size_type new_cap = can_recenter(n) ? capacity() : recommend_cap(size() + n);
+            relayout(new_cap, (new_cap - size() - n) / 2, index, n);
+        }
+        return begin_ + index;
+    }
+
+    // undoes open_gap when filling the gap threw
+    TGP_CONSTEXPR_SINCE_CXX20 void close_gap(pointer p, const size_type n) noexcept {
+        relocate(p + n, end_, p);
+        end_ -= n;
+    }
+
+    /*
+     * inserts n elements that construct builds all or nothing into uninitialized storage. trivially
+     * relocatable elements get a gap opened for them; the others are built at the nearer end and rotated
+     * into place.
+     */
+    template<class Construct>
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert_n(const size_type index, const size_type n, Construct construct) {
+        if constexpr (trivially_relocatable) {
+            pointer p = open_gap(index, n);
+            TGP_TRY {
+                construct(tgp::to_address(p));
+            } TGP_CATCH (...) {
+                close_gap(p, n);
+                TGP_THROW;
+            }
+            return p;
+        } else {
+            if (index < size() - index) {
+                make_room_at_front(n);
+                construct(tgp::to_address(begin_ - n));
+                begin_ -= n;
+                std::rotate(begin_, begin_ + n, begin_ + n + index);
+            } else {
+                make_room_at_back(n);
+                construct(tgp::to_address(end_));
+                end_ += n;
+                std::rotate(begin_ + index, end_ - n, end_);
+            }
+            return begin_ + index;
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void allocate_devector(const size_type n) {
+        if (n > max_size())
+            TGP_TRY_THROW(std::length_error("tgp::devector::allocate_devector demanding size exceeds max size"));
+        auto allocation = tgp::allocate_at_least(alloc_, n);
+        first_ = begin_ = end_ = allocation.ptr;
+        cap_   = first_ + allocation.count;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void destroy_devector() noexcept {
+        if (first_) {
+            clear();
+            alloc_traits::deallocate(alloc_, first_, capacity());
+        }
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void deallocate_devector() noexcept {
+        destroy_devector();
+        first_ = begin_ = end_ = cap_ = nullptr;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void steal(devector& other) noexcept {
+        first_ = other.first_;
+        begin_ = other.begin_;
+        end_   = other.end_;
+        cap_   = other.cap_;
+        other.first_ = other.begin_ = other.end_ = other.cap_ = nullptr;
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 bool is_internal_element_ref(const value_type& value) const noexcept {
+        return std::addressof(value) >= tgp::to_address(begin_) &&
+               std::addressof(value) < tgp::to_address(end_);
+    }
+    /* end of private function members */
+
+}; // end of class devector
+
+NAMESPACE_TGP_END
+
+namespace std {
+
+template<class T, class Alloc, class GrowthPolicy>
+void swap(tgp::devector<T, Alloc, GrowthPolicy>& lhs, tgp::devector<T, Alloc, GrowthPolicy>& rhs)
+noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+} // end of namespace std
+
+#endif // end of TSTL_INCLUDE_TGP_DEVECTOR_H
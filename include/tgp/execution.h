@@ -0,0 +1,115 @@
+#ifndef TSTL_INCLUDE_TGP_EXECUTION_H
+#define TSTL_INCLUDE_TGP_EXECUTION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <tgp/config.h>
+#include <tgp/memory.h>
+#include <tgp/page.h>
+
+NAMESPACE_TGP_BEGIN
+
+/* begin of parallel_policy */
+/*
+ * selects the overloads of containers that construct their elements from several threads. each thread
+ * constructs one contiguous chunk and so first-touches its pages, which the kernel then places on the numa
+ * node of that thread; threads processing the elements later should split them the same way.
+ */
+struct parallel_policy {
+    // 0 uses one thread per hardware thread
+    unsigned    threads         = 0;
+    // the least bytes a thread constructs, and at least a page, smaller ranges take fewer threads
+    std::size_t min_chunk_bytes = std::size_t(1) << 20;
+
+    TGP_NODISCARD unsigned concurrency() const noexcept {
+        if (threads > 0)
+            return threads;
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+};
+
+inline constexpr parallel_policy par{};
+/* end of parallel_policy */
+
+
+/* begin of parallel uninitialized algorithms */
+/*
+ * constructs [first, first + n) by calling construct(chunk, count) on consecutive chunks from several threads,
+ * the calling thread taking the first one. the chunks meet at page boundaries, the first one taking the partial
+ * page at the front and the last one the partial page at the back, so each page is first-touched by one thread;
+ * only an element straddling a boundary, when sizeof(T) does not divide the page size, writes to both pages.
+ * construct must build its chunk all or nothing. if some chunks throw, the others are destroyed and the first
+ * exception is rethrown, so the whole range is constructed or nothing is.
+ * the allocator's construct and destroy are called concurrently.
+ */
+template<class Alloc, class T, class Construct>
+void parallel_uninitialized_construct(const parallel_policy& policy, Alloc& alloc, T* first, const std::size_t n,
+                                      Construct construct) {
+    const std::size_t page  = page_size();
+    const std::size_t bytes = n * sizeof(T);
+    const std::size_t max_chunks = std::max<std::size_t>(bytes / std::max(policy.min_chunk_bytes, page), 1);
+    const std::size_t chunks = std::min<std::size_t>(policy.concurrency(), max_chunks);
+    if (chunks <= 1) {
+        construct(first, n);
+        return;
+    }
+
+    // chunk i is [bounds[i], bounds[i + 1]), each bound the first element starting on or after a page boundary
+    const auto address = reinterpret_cast<std::uintptr_t>(first);
+    const std::size_t chunk_bytes = round_up_to(bytes / chunks, page);
+    std::vector<std::size_t> bounds{0};
+    bounds.reserve(chunks + 1);
+    for (std::size_t i = 1; i < chunks; ++i) {
+        const std::uintptr_t boundary = (address + i * chunk_bytes + page - 1) & ~std::uintptr_t(page - 1);
+        const std::size_t bound = std::min<std::size_t>((boundary - address + sizeof(T) - 1) / sizeof(T), n);
+        if (bound > bounds.back())
+            bounds.push_back(bound);
+    }
+    if (bounds.back() < n)
+        bounds.push_back(n);
+    const std::size_t count = bounds.size() - 1;
+
+    const auto errors = std::make_unique<std::exception_ptr[]>(count);
+    const auto run = [&](const std::size_t i) noexcept {
+        TGP_TRY {
+            construct(first + bounds[i], bounds[i + 1] - bounds[i]);
+        } TGP_CATCH (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(count - 1);
+    for (std::size_t i = 1; i < count; ++i) {
+        TGP_TRY {
+            workers.emplace_back(run, i);
+        } TGP_CATCH (...) {
+            // out of threads, the caller takes the chunk
+            run(i);
+        }
+    }
+    run(0);
+    for (auto& worker : workers)
+        worker.join();
+
+    const auto failed = std::find_if(errors.get(), errors.get() + count,
+                                     [](const std::exception_ptr& e) { return static_cast<bool>(e); });
+    if (failed != errors.get() + count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (!errors[i])
+                allocator_destroy(alloc, first + bounds[i], first + bounds[i + 1]);
+        }
+        std::rethrow_exception(*failed);
+    }
+}
+/* end of parallel uninitialized algorithms */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_EXECUTION_H
@@ -0,0 +1,14 @@
+#ifndef TSTL_INCLUDE_TGP_EXECUTION_FWD_H
+#define TSTL_INCLUDE_TGP_EXECUTION_FWD_H
+
+#include <tgp/config.h>
+
+NAMESPACE_TGP_BEGIN
+
+// declares the policy of the parallel overloads for the containers, which call into tgp/execution.h only when
+// they are used. the caller includes that header anyway to name tgp::par, and links the threads library
+struct parallel_policy;
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_EXECUTION_FWD_H
@@ -0,0 +1,623 @@
+#ifndef TSTL_INCLUDE_TGP_FLAT_MAP_H
+#define TSTL_INCLUDE_TGP_FLAT_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include <tgp/config.h>
+#include <tgp/compare.h>
+#include <tgp/exception.h>
+#include <tgp/flat_tree.h>
+#include <tgp/vector.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a map keeping its keys sorted in one sequence container and the mapped values at the same positions in
+ * another, like C++23 std::flat_map. lookups binary search the keys alone, and iterating yields pairs of
+ * references into both. inserting a range sorts the new elements and merges them in one pass, so building a
+ * map costs O(n log n) whichever way the elements come in. extract and replace hand both containers over
+ * without copying them.
+ * modifiers that fail halfway leave the map empty rather than with keys and values out of step.
+ */
+template<class Key, class T, class Compare = std::less<Key>,
+         class KeyContainer = vector<Key>, class MappedContainer = vector<T>>
+class flat_map {
+    static_assert(is_same_v<Key, typename KeyContainer::value_type>);
+    static_assert(is_same_v<T, typename MappedContainer::value_type>);
+
+    template<bool Const>
+    class basic_iterator;
+
+public:
+    /* begin of public alias members */
+    using key_type               = Key;
+    using mapped_type            = T;
+    using value_type             = std::pair<key_type, mapped_type>;
+    using key_compare            = Compare;
+    using reference              = std::pair<const key_type&, mapped_type&>;
+    using const_reference        = std::pair<const key_type&, const mapped_type&>;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using iterator               = basic_iterator<false>;
+    using const_iterator         = basic_iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using key_container_type     = KeyContainer;
+    using mapped_container_type  = MappedContainer;
+
+    struct containers {
+        key_container_type keys;
+        mapped_container_type values;
+    };
+    /* end of public alias members */
+
+
+    /* begin of constructor */
+    flat_map() = default;
+
+    explicit flat_map(const key_compare& comp) : comp_(comp) {}
+
+    flat_map(key_container_type keys, mapped_container_type values, const key_compare& comp = key_compare())
+        : comp_(comp) {
+        TGP_PRECONDITION(keys.size() == values.size());
+        merge_unsorted(std::move(keys), std::move(values));
+    }
+
+    flat_map(sorted_unique_t, key_container_type keys, mapped_container_type values,
+             const key_compare& comp = key_compare())
+        : c_{std::move(keys), std::move(values)}, comp_(comp) {
+        TGP_PRECONDITION(c_.keys.size() == c_.values.size());
+        TGP_ASSERT_SEMANTIC_REQUIREMENT(flat_tree_is_sorted_unique(c_.keys, comp_));
+    }
+
+    template<class InputIt>
+    flat_map(InputIt first, InputIt last, const key_compare& comp = key_compare()) : comp_(comp) {
+        insert(first, last);
+    }
+
+    template<class InputIt>
+    flat_map(sorted_unique_t, InputIt first, InputIt last, const key_compare& comp = key_compare())
+        : comp_(comp) {
+        insert(sorted_unique, first, last);
+    }
+
+    flat_map(std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+        : flat_map(init.begin(), init.end(), comp) {}
+
+    flat_map(sorted_unique_t, std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+        : flat_map(sorted_unique, init.begin(), init.end(), comp) {}
+
+    flat_map& operator=(std::initializer_list<value_type> init) {
+        clear();
+        insert(init);
+        return *this;
+    }
+    /* end of constructor */
+
+
+    /* begin of iterators */
+    TGP_NODISCARD iterator begin() noexcept {
+        return iterator(c_.keys.cbegin(), c_.values.begin());
+    }
+
+    TGP_NODISCARD const_iterator begin() const noexcept {
+        return const_iterator(c_.keys.begin(), c_.values.begin());
+    }
+
+    TGP_NODISCARD iterator end() noexcept {
+        return iterator(c_.keys.cend(), c_.values.end());
+    }
+
+    TGP_NODISCARD const_iterator end() const noexcept {
+        return const_iterator(c_.keys.end(), c_.values.end());
+    }
+
+    TGP_NODISCARD const_iterator cbegin() const noexcept { return begin(); }
+    TGP_NODISCARD const_iterator cend() const noexcept { return end(); }
+    TGP_NODISCARD reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    TGP_NODISCARD const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    TGP_NODISCARD reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    TGP_NODISCARD const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    TGP_NODISCARD bool empty() const noexcept {
+        return c_.keys.empty();
+    }
+
+    TGP_NODISCARD size_type size() const noexcept {
+        return c_.keys.size();
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return std::min<size_type>(c_.keys.max_size(), c_.values.max_size());
+    }
+    /* end of capacity */
+
+
+    /* begin of element access */
+    mapped_type& operator[](const key_type& key) {
+        return try_emplace(key).first->second;
+    }
+
+    mapped_type& operator[](key_type&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    TGP_NODISCARD mapped_type& at(const key_type& key) {
+        return at_key(*this, key);
+    }
+
+    TGP_NODISCARD const mapped_type& at(const key_type& key) const {
+        return at_key(*this, key);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD mapped_type& at(const K& key) {
+        return at_key(*this, key);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD const mapped_type& at(const K& key) const {
+        return at_key(*this, key);
+    }
+    /* end of element access */
+
+
+    /* begin of modifiers */
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(std::forward<Args>(args)...);
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    // appends the elements, sorts them and merges them with the elements held before
+    template<class InputIt>
+    void insert(InputIt first, InputIt last) {
+        containers incoming = collect(first, last);
+        merge_unsorted(std::move(incoming.keys), std::move(incoming.values));
+    }
+
+    template<class InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last) {
+        containers incoming = collect(first, last);
+        TGP_ASSERT_SEMANTIC_REQUIREMENT(flat_tree_is_sorted_unique(incoming.keys, comp_));
+        merge_sorted(std::move(incoming.keys), std::move(incoming.values));
+    }
+
+    void insert(std::initializer_list<value_type> init) {
+        insert(init.begin(), init.end());
+    }
+
+    void insert(sorted_unique_t, std::initializer_list<value_type> init) {
+        insert(sorted_unique, init.begin(), init.end());
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+        return try_emplace_key(key, std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& obj) {
+        return insert_or_assign_key(key, std::forward<M>(obj));
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& obj) {
+        return insert_or_assign_key(std::move(key), std::forward<M>(obj));
+    }
+
+    // hands both containers over and leaves the map empty
+    TGP_NODISCARD containers extract() && {
+        containers c = std::move(c_);
+        clear();
+        return c;
+    }
+
+    void replace(key_container_type&& keys, mapped_container_type&& values) {
+        TGP_PRECONDITION(keys.size() == values.size());
+        TGP_ASSERT_SEMANTIC_REQUIREMENT(flat_tree_is_sorted_unique(keys, comp_));
+        c_.keys   = std::move(keys);
+        c_.values = std::move(values);
+    }
+
+    iterator erase(const_iterator pos) {
+        const auto offset = pos.key_ - c_.keys.cbegin();
+        return erase_at(offset, offset + 1);
+    }
+
+    iterator erase(iterator pos) {
+        return erase(const_iterator(pos));
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        return erase_at(first.key_ - c_.keys.cbegin(), last.key_ - c_.keys.cbegin());
+    }
+
+    size_type erase(const key_type& key) {
+        return erase_key(key);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent,
+             enable_if_t<!std::is_convertible_v<K&&, iterator> && !std::is_convertible_v<K&&, const_iterator>, int> = 0>
+    size_type erase(K&& key) {
+        return erase_key(key);
+    }
+
+    void swap(flat_map& other) noexcept {
+        using std::swap;
+        swap(c_.keys, other.c_.keys);
+        swap(c_.values, other.c_.values);
+        swap(comp_, other.comp_);
+    }
+
+    void clear() noexcept {
+        c_.keys.clear();
+        c_.values.clear();
+    }
+    /* end of modifiers */
+
+
+    /* begin of lookup */
+    TGP_NODISCARD key_compare key_comp() const {
+        return comp_;
+    }
+
+    TGP_NODISCARD const key_container_type& keys() const noexcept {
+        return c_.keys;
+    }
+
+    TGP_NODISCARD const mapped_container_type& values() const noexcept {
+        return c_.values;
+    }
+
+    TGP_NODISCARD iterator find(const key_type& key) {
+        return at_offset(find_offset(key));
+    }
+
+    TGP_NODISCARD const_iterator find(const key_type& key) const {
+        return at_offset(find_offset(key));
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD iterator find(const K& key) {
+        return at_offset(find_offset(key));
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD const_iterator find(const K& key) const {
+        return at_offset(find_offset(key));
+    }
+
+    TGP_NODISCARD size_type count(const key_type& key) const {
+        return contains(key);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD size_type count(const K& key) const {
+        return contains(key);
+    }
+
+    TGP_NODISCARD bool contains(const key_type& key) const {
+        return find_offset(key) != size();
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD bool contains(const K& key) const {
+        return find_offset(key) != size();
+    }
+
+    TGP_NODISCARD iterator lower_bound(const key_type& key) {
+        return at_offset(lower_bound_offset(key));
+    }
+
+    TGP_NODISCARD const_iterator lower_bound(const key_type& key) const {
+        return at_offset(lower_bound_offset(key));
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD iterator lower_bound(const K& key) {
+        return at_offset(lower_bound_offset(key));
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD const_iterator lower_bound(const K& key) const {
+        return at_offset(lower_bound_offset(key));
+    }
+
+    TGP_NODISCARD iterator upper_bound(const key_type& key) {
+        return at_offset(upper_bound_offset(key));
+    }
+
+    TGP_NODISCARD const_iterator upper_bound(const key_type& key) const {
+        return at_offset(upper_bound_offset(key));
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD iterator upper_bound(const K& key) {
+        return at_offset(upper_bound_offset(key));
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD const_iterator upper_bound(const K& key) const {
+        return at_offset(upper_bound_offset(key));
+    }
+
+    TGP_NODISCARD std::pair<iterator, iterator> equal_range(const key_type& key) {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    TGP_NODISCARD std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD std::pair<iterator, iterator> equal_range(const K& key) {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD std::pair<const_iterator, const_iterator> equal_range(const K& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    /* end of lookup */
+
+private:
+    /* begin of private data members */
+    containers c_;
+    key_compare comp_;
+    /* end of private data members */
+
+
+    /* begin of private function members */
+    TGP_NODISCARD iterator at_offset(const size_type offset) noexcept {
+        const auto n = static_cast<difference_type>(offset);
+        return iterator(c_.keys.cbegin() + n, c_.values.begin() + n);
+    }
+
+    TGP_NODISCARD const_iterator at_offset(const size_type offset) const noexcept {
+        const auto n = static_cast<difference_type>(offset);
+        return const_iterator(c_.keys.cbegin() + n, c_.values.cbegin() + n);
+    }
+
+    template<class K>
+    TGP_NODISCARD size_type lower_bound_offset(const K& key) const {
+        return static_cast<size_type>(std::lower_bound(c_.keys.begin(), c_.keys.end(), key, comp_) - c_.keys.begin());
+    }
+
+    template<class K>
+    TGP_NODISCARD size_type upper_bound_offset(const K& key) const {
+        return static_cast<size_type>(std::upper_bound(c_.keys.begin(), c_.keys.end(), key, comp_) - c_.keys.begin());
+    }
+
+    // the offset of key, or size() if there is none
+    template<class K>
+    TGP_NODISCARD size_type find_offset(const K& key) const {
+        const size_type i = lower_bound_offset(key);
+        return i != size() && !comp_(key, c_.keys.begin()[static_cast<difference_type>(i)]) ? i : size();
+    }
+
+    template<class Self, class K>
+    TGP_NODISCARD static auto& at_key(Self& self, const K& key) {
+        const size_type i = self.find_offset(key);
+        if (i == self.size())
+            TGP_TRY_THROW(std::out_of_range("tgp::flat_map::at key not found"));
+        return self.c_.values.begin()[static_cast<difference_type>(i)];
+    }
+
+    template<class K, class... Args>
+    std::pair<iterator, bool> try_emplace_key(K&& key, Args&&... args) {
+        const size_type i = lower_bound_offset(key);
+        const auto n = static_cast<difference_type>(i);
+        if (i != size() && !comp_(key, c_.keys.begin()[n]))
+            return {at_offset(i), false};
+        c_.keys.insert(c_.keys.begin() + n, std::forward<K>(key));
+        TGP_TRY {
+            c_.values.emplace(c_.values.begin() + n, std::forward<Args>(args)...);
+        } TGP_CATCH (...) {
+            c_.keys.erase(c_.keys.begin() + n);
+            TGP_THROW;
+        }
+        return {at_offset(i), true};
+    }
+
+    template<class K, class M>
+    std::pair<iterator, bool> insert_or_assign_key(K&& key, M&& obj) {
+        auto result = try_emplace_key(std::forward<K>(key), std::forward<M>(obj));
+        if (!result.second)
+            result.first->second = std::forward<M>(obj);
+        return result;
+    }
+
+    template<class K>
+    size_type erase_key(const K& key) {
+        const size_type i = find_offset(key);
+        if (i == size())
+            return 0;
+        erase_at(static_cast<difference_type>(i), static_cast<difference_type>(i) + 1);
+        return 1;
+    }
+
+    iterator erase_at(const difference_type first, const difference_type last) {
+        c_.keys.erase(c_.keys.begin() + first, c_.keys.begin() + last);
+        c_.values.erase(c_.values.begin() + first, c_.values.begin() + last);
+        return at_offset(static_cast<size_type>(first));
+    }
+
+    template<class InputIt>
+    TGP_NODISCARD static containers collect(InputIt first, InputIt last) {
+        containers c;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                                        typename std::iterator_traits<InputIt>::iterator_category>) {
+            const auto n = static_cast<size_type>(std::distance(first, last));
+            flat_tree_reserve(c.keys, n);
+            flat_tree_reserve(c.values, n);
+        }
+        for (; first != last; ++first) {
+            const auto& element = *first;
+            c.keys.push_back(std::get<0>(element));
+            c.values.push_back(std::get<1>(element));
+        }
+        return c;
+    }
+
+    // sorts both columns by key, keeping the first of equivalent keys, and merges them in
+    void merge_unsorted(key_container_type&& keys, mapped_container_type&& values) {
+        const vector<std::size_t> order = flat_tree_sorted_order(keys, comp_);
+        key_container_type sorted_keys = flat_tree_permuted(keys, order);
+        mapped_container_type sorted_values = flat_tree_permuted(values, order);
+        merge_sorted(std::move(sorted_keys), std::move(sorted_values));
+    }
+
+    // merges sorted columns into the map in one pass, an element already in the map stays
+    void merge_sorted(key_container_type&& keys, mapped_container_type&& values) {
+        if (keys.empty())
+            return;
+        if (empty() && flat_tree_is_sorted_unique(keys, comp_)) {
+            c_.keys   = std::move(keys);
+            c_.values = std::move(values);
+            return;
+        }
+        TGP_TRY {
+            containers merged;
+            flat_tree_reserve(merged.keys, size() + keys.size());
+            flat_tree_reserve(merged.values, size() + keys.size());
+            auto ak = c_.keys.begin();
+            auto av = c_.values.begin();
+            auto bk = keys.begin();
+            auto bv = values.begin();
+            while (ak != c_.keys.end() || bk != keys.end()) {
+                if (bk == keys.end() || (ak != c_.keys.end() && !comp_(*bk, *ak))) {
+                    merged.keys.push_back(std::move(*ak++));
+                    merged.values.push_back(std::move(*av++));
+                } else {
+                    if (merged.keys.empty() || comp_(merged.keys.back(), *bk)) {
+                        merged.keys.push_back(std::move(*bk));
+                        merged.values.push_back(std::move(*bv));
+                    }
+                    ++bk;
+                    ++bv;
+                }
+            }
+            c_ = std::move(merged);
+        } TGP_CATCH (...) {
+            clear();
+            TGP_THROW;
+        }
+    }
+    /* end of private function members */
+
+}; // end of class flat_map
+
+
+/* begin of flat_map iterator */
+// an iterator into the keys and one into the values, moving in lockstep
+template<class Key, class T, class Compare, class KeyContainer, class MappedContainer>
+template<bool Const>
+class flat_map<Key, T, Compare, KeyContainer, MappedContainer>::basic_iterator {
+    using key_iterator    = typename KeyContainer::const_iterator;
+    using mapped_iterator = conditional_t<Const, typename MappedContainer::const_iterator,
+                                                 typename MappedContainer::iterator>;
+
+public:
+    // operator* returns a proxy, which only c++20 iterators may do
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept  = std::random_access_iterator_tag;
+    using value_type        = std::pair<Key, T>;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = std::pair<const Key&, conditional_t<Const, const T&, T&>>;
+
+    // operator-> hands out a pointer to a pair of references it holds
+    struct pointer {
+        reference ref;
+
+        TGP_NODISCARD reference* operator->() noexcept { return std::addressof(ref); }
+    };
+
+    basic_iterator() = default;
+
+    basic_iterator(key_iterator key, mapped_iterator mapped) noexcept : key_(key), mapped_(mapped) {}
+
+    template<bool C = Const, enable_if_t<C, int> = 0>
+    basic_iterator(const basic_iterator<false>& other) noexcept : key_(other.key_), mapped_(other.mapped_) {}
+
+    TGP_NODISCARD reference operator*() const noexcept { return reference(*key_, *mapped_); }
+    TGP_NODISCARD pointer operator->() const noexcept { return pointer{**this}; }
+    TGP_NODISCARD reference operator[](const difference_type n) const noexcept { return *(*this + n); }
+
+    basic_iterator& operator++() noexcept { ++key_; ++mapped_; return *this; }
+    basic_iterator& operator--() noexcept { --key_; --mapped_; return *this; }
+
+    basic_iterator operator++(int) noexcept { basic_iterator tmp = *this; ++*this; return tmp; }
+    basic_iterator operator--(int) noexcept { basic_iterator tmp = *this; --*this; return tmp; }
+
+    basic_iterator& operator+=(const difference_type n) noexcept { key_ += n; mapped_ += n; return *this; }
+    basic_iterator& operator-=(const difference_type n) noexcept { return *this += -n; }
+
+    TGP_NODISCARD friend basic_iterator operator+(basic_iterator it, const difference_type n) noexcept {
+        return it += n;
+    }
+
+    TGP_NODISCARD friend basic_iterator operator+(const difference_type n, basic_iterator it) noexcept {
+        return it += n;
+    }
+
+    TGP_NODISCARD friend basic_iterator operator-(basic_iterator it, const difference_type n) noexcept {
+        return it -= n;
+    }
+
+    TGP_NODISCARD friend difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.key_ - rhs.key_;
+    }
+
+    TGP_NODISCARD friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.key_ == rhs.key_;
+    }
+
+    TGP_NODISCARD friend auto operator<=>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.key_ <=> rhs.key_;
+    }
+
+private:
+    friend class basic_iterator<!Const>;
+    friend class flat_map;
+
+    key_iterator key_{};
+    mapped_iterator mapped_{};
+};
+/* end of flat_map iterator */
+
+NAMESPACE_TGP_END
+
+namespace std {
+
+template<class Key, class T, class Compare, class KeyContainer, class MappedContainer>
+void swap(tgp::flat_map<Key, T, Compare, KeyContainer, MappedContainer>& lhs,
+          tgp::flat_map<Key, T, Compare, KeyContainer, MappedContainer>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // end of namespace std
+
+#endif // end of TSTL_INCLUDE_TGP_FLAT_MAP_H
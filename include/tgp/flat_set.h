@@ -0,0 +1,337 @@
+#ifndef TSTL_INCLUDE_TGP_FLAT_SET_H
+#define TSTL_INCLUDE_TGP_FLAT_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include <tgp/config.h>
+#include <tgp/compare.h>
+#include <tgp/flat_tree.h>
+#include <tgp/vector.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a set keeping its keys sorted in a sequence container, like C++23 std::flat_set. lookups are binary
+ * searches over contiguous keys, inserting one key shifts the keys after it. inserting a range sorts the new
+ * keys and merges them in one pass, so building a set costs O(n log n) whichever way the keys come in.
+ * extract and replace hand the container over without copying it.
+ */
+template<class Key, class Compare = std::less<Key>, class KeyContainer = vector<Key>>
+class flat_set {
+    static_assert(is_same_v<Key, typename KeyContainer::value_type>);
+
+public:
+    /* begin of public alias members */
+    using key_type               = Key;
+    using value_type             = Key;
+    using key_compare            = Compare;
+    using value_compare          = Compare;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using size_type              = typename KeyContainer::size_type;
+    using difference_type        = typename KeyContainer::difference_type;
+    using iterator               = typename KeyContainer::const_iterator;
+    using const_iterator         = typename KeyContainer::const_iterator;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using container_type         = KeyContainer;
+    /* end of public alias members */
+
+
+    /* begin of constructor */
+    flat_set() = default;
+
+    explicit flat_set(const key_compare& comp) : comp_(comp) {}
+
+    explicit flat_set(container_type cont, const key_compare& comp = key_compare())
+        : keys_(std::move(cont)), comp_(comp) {
+        sort_and_unique();
+    }
+
+    flat_set(sorted_unique_t, container_type cont, const key_compare& comp = key_compare())
+        : keys_(std::move(cont)), comp_(comp) {
+        TGP_ASSERT_SEMANTIC_REQUIREMENT(flat_tree_is_sorted_unique(keys_, comp_));
+    }
+
+    template<class InputIt>
+    flat_set(InputIt first, InputIt last, const key_compare& comp = key_compare()) : comp_(comp) {
+        insert(first, last);
+    }
+
+    template<class InputIt>
+    flat_set(sorted_unique_t, InputIt first, InputIt last, const key_compare& comp = key_compare())
+        : keys_(first, last), comp_(comp) {
+        TGP_ASSERT_SEMANTIC_REQUIREMENT(flat_tree_is_sorted_unique(keys_, comp_));
+    }
+
+    flat_set(std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+        : flat_set(init.begin(), init.end(), comp) {}
+
+    flat_set(sorted_unique_t, std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+        : flat_set(sorted_unique, init.begin(), init.end(), comp) {}
+
+    flat_set& operator=(std::initializer_list<value_type> init) {
+        clear();
+        insert(init);
+        return *this;
+    }
+    /* end of constructor */
+
+
+    /* begin of iterators */
+    TGP_NODISCARD iterator begin() const noexcept { return keys_.begin(); }
+    TGP_NODISCARD iterator end() const noexcept { return keys_.end(); }
+    TGP_NODISCARD const_iterator cbegin() const noexcept { return keys_.begin(); }
+    TGP_NODISCARD const_iterator cend() const noexcept { return keys_.end(); }
+    TGP_NODISCARD reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+    TGP_NODISCARD reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    TGP_NODISCARD bool empty() const noexcept {
+        return keys_.empty();
+    }
+
+    TGP_NODISCARD size_type size() const noexcept {
+        return keys_.size();
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return keys_.max_size();
+    }
+    /* end of capacity */
+
+
+    /* begin of modifiers */
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return insert_unique(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return insert_unique(std::move(value));
+    }
+
+    // appends the keys, sorts them and merges them with the keys held before
+    template<class InputIt>
+    void insert(InputIt first, InputIt last) {
+        container_type incoming(first, last);
+        std::stable_sort(incoming.begin(), incoming.end(), comp_);
+        merge_sorted(std::move(incoming));
+    }
+
+    template<class InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last) {
+        container_type incoming(first, last);
+        TGP_ASSERT_SEMANTIC_REQUIREMENT(flat_tree_is_sorted_unique(incoming, comp_));
+        merge_sorted(std::move(incoming));
+    }
+
+    void insert(std::initializer_list<value_type> init) {
+        insert(init.begin(), init.end());
+    }
+
+    void insert(sorted_unique_t, std::initializer_list<value_type> init) {
+        insert(sorted_unique, init.begin(), init.end());
+    }
+
+    // hands the keys over and leaves the set empty
+    TGP_NODISCARD container_type extract() && {
+        container_type keys = std::move(keys_);
+        keys_.clear();
+        return keys;
+    }
+
+    void replace(container_type&& keys) {
+        TGP_ASSERT_SEMANTIC_REQUIREMENT(flat_tree_is_sorted_unique(keys, comp_));
+        keys_ = std::move(keys);
+    }
+
+    iterator erase(const_iterator pos) {
+        return keys_.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        return keys_.erase(first, last);
+    }
+
+    size_type erase(const key_type& key) {
+        return erase_key(key);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent,
+             enable_if_t<!std::is_convertible_v<K&&, const_iterator>, int> = 0>
+    size_type erase(K&& key) {
+        return erase_key(key);
+    }
+
+    void swap(flat_set& other) noexcept {
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(comp_, other.comp_);
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+    }
+    /* end of modifiers */
+
+
+    /* begin of lookup */
+    TGP_NODISCARD key_compare key_comp() const {
+        return comp_;
+    }
+
+    TGP_NODISCARD value_compare value_comp() const {
+        return comp_;
+    }
+
+    TGP_NODISCARD const container_type& keys() const noexcept {
+        return keys_;
+    }
+
+    TGP_NODISCARD iterator find(const key_type& key) const {
+        return find_key(key);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD iterator find(const K& key) const {
+        return find_key(key);
+    }
+
+    TGP_NODISCARD size_type count(const key_type& key) const {
+        return find_key(key) != end();
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD size_type count(const K& key) const {
+        return find_key(key) != end();
+    }
+
+    TGP_NODISCARD bool contains(const key_type& key) const {
+        return find_key(key) != end();
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD bool contains(const K& key) const {
+        return find_key(key) != end();
+    }
+
+    TGP_NODISCARD iterator lower_bound(const key_type& key) const {
+        return std::lower_bound(begin(), end(), key, comp_);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD iterator lower_bound(const K& key) const {
+        return std::lower_bound(begin(), end(), key, comp_);
+    }
+
+    TGP_NODISCARD iterator upper_bound(const key_type& key) const {
+        return std::upper_bound(begin(), end(), key, comp_);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD iterator upper_bound(const K& key) const {
+        return std::upper_bound(begin(), end(), key, comp_);
+    }
+
+    TGP_NODISCARD std::pair<iterator, iterator> equal_range(const key_type& key) const {
+        return std::equal_range(begin(), end(), key, comp_);
+    }
+
+    template<class K, class C = Compare, class = typename C::is_transparent>
+    TGP_NODISCARD std::pair<iterator, iterator> equal_range(const K& key) const {
+        return std::equal_range(begin(), end(), key, comp_);
+    }
+    /* end of lookup */
+
+private:
+    /* begin of private data members */
+    container_type keys_;
+    key_compare comp_;
+    /* end of private data members */
+
+
+    /* begin of private function members */
+    template<class K>
+    TGP_NODISCARD iterator find_key(const K& key) const {
+        const iterator it = std::lower_bound(begin(), end(), key, comp_);
+        return it != end() && !comp_(key, *it) ? it : end();
+    }
+
+    template<class V>
+    std::pair<iterator, bool> insert_unique(V&& value) {
+        const iterator it = std::lower_bound(begin(), end(), value, comp_);
+        if (it != end() && !comp_(value, *it))
+            return {it, false};
+        return {keys_.insert(it, std::forward<V>(value)), true};
+    }
+
+    template<class K>
+    size_type erase_key(const K& key) {
+        const iterator it = find_key(key);
+        if (it == end())
+            return 0;
+        keys_.erase(it);
+        return 1;
+    }
+
+    void sort_and_unique() {
+        std::stable_sort(keys_.begin(), keys_.end(), comp_);
+        keys_.erase(std::unique(keys_.begin(), keys_.end(), [this](const auto& a, const auto& b) {
+            return !comp_(a, b);
+        }), keys_.end());
+    }
+
+    /*
+     * merges sorted keys into the set in one pass. a key already in the set stays, of several equivalent
+     * incoming keys the first one wins. if a move throws the set is left empty.
+     */
+    void merge_sorted(container_type&& incoming) {
+        if (incoming.empty())
+            return;
+        TGP_TRY {
+            container_type merged;
+            flat_tree_reserve(merged, keys_.size() + incoming.size());
+            auto a = keys_.begin();
+            auto b = incoming.begin();
+            while (a != keys_.end() || b != incoming.end()) {
+                if (b == incoming.end() || (a != keys_.end() && !comp_(*b, *a))) {
+                    merged.push_back(std::move(*a++));
+                } else {
+                    if (merged.empty() || comp_(merged.back(), *b))
+                        merged.push_back(std::move(*b));
+                    ++b;
+                }
+            }
+            keys_ = std::move(merged);
+        } TGP_CATCH (...) {
+            keys_.clear();
+            TGP_THROW;
+        }
+    }
+    /* end of private function members */
+
+}; // end of class flat_set
+
+NAMESPACE_TGP_END
+
+namespace std {
+
+template<class Key, class Compare, class KeyContainer>
+void swap(tgp::flat_set<Key, Compare, KeyContainer>& lhs, tgp::flat_set<Key, Compare, KeyContainer>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // end of namespace std
+
+#endif // end of TSTL_INCLUDE_TGP_FLAT_SET_H
@@ -0,0 +1,67 @@
+#ifndef TSTL_INCLUDE_TGP_FLAT_TREE_H
+#define TSTL_INCLUDE_TGP_FLAT_TREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+#include <tgp/config.h>
+#include <tgp/vector.h>
+
+// what flat_map and flat_set share: sorted containers of keys searched by binary search
+
+NAMESPACE_TGP_BEGIN
+
+/* begin of sorted_unique_t */
+// the elements handed over are already sorted by the comparator and hold no equivalent keys
+struct sorted_unique_t {
+    explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+/* end of sorted_unique_t */
+
+
+/* begin of flat_tree algorithms */
+template<class Container>
+void flat_tree_reserve(Container& c, const std::size_t n) {
+    if constexpr (requires { c.reserve(n); })
+        c.reserve(n);
+}
+
+template<class KeyContainer, class Compare>
+TGP_NODISCARD bool flat_tree_is_sorted_unique(const KeyContainer& keys, const Compare& comp) {
+    return std::adjacent_find(keys.begin(), keys.end(), [&comp](const auto& a, const auto& b) {
+        return !comp(a, b);
+    }) == keys.end();
+}
+
+// the positions of keys in stably sorted order, so that other columns can follow the keys
+template<class KeyContainer, class Compare>
+TGP_NODISCARD vector<std::size_t> flat_tree_sorted_order(const KeyContainer& keys, const Compare& comp) {
+    vector<std::size_t> order(keys.size(), default_init);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    const auto first = keys.begin();
+    std::stable_sort(order.begin(), order.end(), [&comp, first](const std::size_t a, const std::size_t b) {
+        return comp(first[static_cast<std::ptrdiff_t>(a)], first[static_cast<std::ptrdiff_t>(b)]);
+    });
+    return order;
+}
+
+// moves the elements of c into a new container in the given order
+template<class Container>
+TGP_NODISCARD Container flat_tree_permuted(Container& c, const vector<std::size_t>& order) {
+    Container result;
+    flat_tree_reserve(result, order.size());
+    const auto first = c.begin();
+    for (const std::size_t i : order)
+        result.push_back(std::move(first[static_cast<std::ptrdiff_t>(i)]));
+    return result;
+}
+/* end of flat_tree algorithms */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_FLAT_TREE_H
@@ -0,0 +1,92 @@
+#ifndef TSTL_INCLUDE_TGP_GROWTH_POLICY_H
+#define TSTL_INCLUDE_TGP_GROWTH_POLICY_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include <tgp/config.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a growth policy picks the capacity a container grows to when it runs out of room:
+ *      static size_type recommend(size_type cap, size_type new_size, size_type max_size, size_type elem_size);
+ * cap is the current capacity and new_size <= max_size the number of elements it must hold,
+ * the result must lie in [new_size, max_size].
+ */
+
+/* begin of double_growth */
+struct double_growth {
+    TGP_NODISCARD static constexpr std::size_t
+    recommend(const std::size_t cap, const std::size_t new_size, const std::size_t max_size, std::size_t) noexcept {
+        if (cap > max_size / 2)
+            return max_size;
+        return std::max(cap * 2, new_size);
+    }
+};
+/* end of double_growth */
+
+
+/* begin of one_and_half_growth */
+// keeps the waste below 33% and lets a block be carved out of the blocks freed before it
+struct one_and_half_growth {
+    TGP_NODISCARD static constexpr std::size_t
+    recommend(const std::size_t cap, const std::size_t new_size, const std::size_t max_size, std::size_t) noexcept {
+        if (cap > max_size - cap / 2)
+            return max_size;
+        return std::max(cap + cap / 2, new_size);
+    }
+};
+/* end of one_and_half_growth */
+
+
+/* begin of page_rounded_growth */
+// rounds the capacity of buffers of at least one page up to whole pages
+template<class Base = double_growth, std::size_t PageSize = 4096>
+struct page_rounded_growth {
+    static_assert(std::has_single_bit(PageSize));
+
+    TGP_NODISCARD static constexpr std::size_t
+    recommend(const std::size_t cap, const std::size_t new_size, const std::size_t max_size,
+              const std::size_t elem_size) noexcept {
+        const std::size_t n = Base::recommend(cap, new_size, max_size, elem_size);
+        if (n > (SIZE_MAX - PageSize) / elem_size || n * elem_size < PageSize)
+            return n;
+        const std::size_t bytes = (n * elem_size + PageSize - 1) & ~(PageSize - 1);
+        return std::min(bytes / elem_size, max_size);
+    }
+};
+/* end of page_rounded_growth */
+
+
+/* begin of size_class_rounded_growth */
+// the size class malloc implementations like jemalloc and tcmalloc serve a request of the given bytes from
+TGP_NODISCARD constexpr std::size_t malloc_size_class(const std::size_t bytes) noexcept {
+    if (bytes <= 16)
+        return bytes <= 8 ? 8 : 16;
+    if (bytes <= 128)
+        return (bytes + 15) & ~std::size_t(15);
+    // four classes per power of two
+    const std::size_t spacing = std::size_t(1) << (std::bit_width(bytes - 1) - 3);
+    return (bytes + spacing - 1) & ~(spacing - 1);
+}
+
+// rounds the capacity up to the end of the allocator's size class, so the slack becomes usable capacity
+template<class Base = double_growth>
+struct size_class_rounded_growth {
+    TGP_NODISCARD static constexpr std::size_t
+    recommend(const std::size_t cap, const std::size_t new_size, const std::size_t max_size,
+              const std::size_t elem_size) noexcept {
+        const std::size_t n = Base::recommend(cap, new_size, max_size, elem_size);
+        if (n > SIZE_MAX / 2 / elem_size)
+            return n;
+        return std::min(malloc_size_class(n * elem_size) / elem_size, max_size);
+    }
+};
+/* end of size_class_rounded_growth */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_GROWTH_POLICY_H
@@ -0,0 +1,181 @@
+#ifndef TSTL_INCLUDE_TGP_HUGE_PAGE_ALLOCATOR_H
+#define TSTL_INCLUDE_TGP_HUGE_PAGE_ALLOCATOR_H
+
+#if !defined(__linux__)
+#   error "tgp/huge_page_allocator.h requires linux transparent huge pages"
+#endif
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#include <tgp/config.h>
+#include <tgp/exception.h>
+#include <tgp/memory.h>
+#include <tgp/page.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * an allocator for very large buffers. blocks of at least ThresholdBytes are mapped from anonymous memory
+ * aligned to and rounded up to huge pages, and advised to be backed by transparent huge pages. the mapping
+ * only reserves address space, pages are committed as they are first written, so reserve() on a huge vector
+ * costs nothing until elements are constructed; Populate commits all of them up front instead.
+ * smaller blocks come from operator new. mapped blocks grow with mremap, which moves page tables instead of
+ * the bytes, so a vector of trivially relocatable elements never copies them when it grows. a block that has
+ * to move is remapped onto a fresh aligned reservation, so it stays aligned to huge pages.
+ */
+template<class T, std::size_t ThresholdBytes = huge_page_size, bool Populate = false>
+class huge_page_allocator {
+public:
+    /* begin of public alias members */
+    using value_type                             = T;
+    using size_type                              = std::size_t;
+    using difference_type                        = std::ptrdiff_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal                        = std::true_type;
+
+    template<class U>
+    struct rebind {
+        using other = huge_page_allocator<U, ThresholdBytes, Populate>;
+    };
+
+    static constexpr std::size_t threshold = ThresholdBytes;
+    /* end of public alias members */
+
+
+    /* begin of function members */
+    huge_page_allocator() noexcept = default;
+
+    template<class U>
+    huge_page_allocator(const huge_page_allocator<U, ThresholdBytes, Populate>&) noexcept {}
+
+    TGP_NODISCARD T* allocate(const size_type n) {
+        return allocate_at_least(n).ptr;
+    }
+
+    TGP_NODISCARD allocation_result<T*> allocate_at_least(const size_type n) {
+        if (n > max_size())
+            TGP_TRY_THROW(std::bad_array_new_length());
+        const std::size_t bytes = n * sizeof(T);
+        if (!is_mapped(bytes))
+            return {static_cast<T*>(::operator new(bytes, std::align_val_t(alignof(T)))), n};
+        const std::size_t mapped_bytes = mapping_size(bytes);
+        return {static_cast<T*>(map(mapped_bytes)), mapped_bytes / sizeof(T)};
+    }
+
+    void deallocate(T* p, const size_type n) noexcept {
+        const std::size_t bytes = n * sizeof(T);
+        if (is_mapped(bytes))
+            ::munmap(p, mapping_size(bytes));
+        else
+            ::operator delete(p, bytes, std::align_val_t(alignof(T)));
+    }
+
+    size_type expand_in_place(T* p, const size_type n, const size_type new_n) noexcept {
+        if (!is_mapped(n * sizeof(T)) || new_n > max_size())
+            return 0;
+        const std::size_t old_bytes = mapping_size(n * sizeof(T));
+        const std::size_t new_bytes = mapping_size(new_n * sizeof(T));
+        if (::mremap(p, old_bytes, new_bytes, 0) == MAP_FAILED)
+            return 0;
+        if constexpr (Populate) {
+            if (new_bytes > old_bytes)
+                populate(reinterpret_cast<char*>(p) + old_bytes, new_bytes - old_bytes);
+        }
+        return new_bytes / sizeof(T);
+    }
+
+    TGP_NODISCARD allocation_result<T*> reallocate(T* p, const size_type n, const size_type new_n) {
+        if (is_mapped(n * sizeof(T)) && new_n <= max_size() && is_mapped(new_n * sizeof(T))) {
+            const std::size_t old_bytes = mapping_size(n * sizeof(T));
+            const std::size_t new_bytes = mapping_size(new_n * sizeof(T));
+            // left to itself the kernel may move the block to any page boundary
+            void* const target = reserve_aligned(new_bytes);
+            void* q = ::mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+            if (q == MAP_FAILED) {
+                ::munmap(target, new_bytes);
+                TGP_TRY_THROW(std::bad_alloc());
+            }
+            ::madvise(q, new_bytes, MADV_HUGEPAGE);
+            if constexpr (Populate) {
+                if (new_bytes > old_bytes)
+                    populate(static_cast<char*>(q) + old_bytes, new_bytes - old_bytes);
+            }
+            return {static_cast<T*>(q), new_bytes / sizeof(T)};
+        }
+        auto result = allocate_at_least(new_n);
+        std::memcpy(static_cast<void*>(result.ptr), static_cast<const void*>(p), std::min(n, new_n) * sizeof(T));
+        deallocate(p, n);
+        return result;
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return (static_cast<size_type>(PTRDIFF_MAX) - huge_page_size) / sizeof(T);
+    }
+    /* end of function members */
+
+private:
+    /* begin of private function members */
+    TGP_NODISCARD static bool is_mapped(const std::size_t bytes) noexcept {
+        return bytes >= ThresholdBytes;
+    }
+
+    TGP_NODISCARD static std::size_t mapping_size(const std::size_t bytes) noexcept {
+        return round_up_to(bytes, huge_page_size);
+    }
+
+    // maps bytes of address space aligned to a huge page and advised to be backed by them
+    TGP_NODISCARD static void* map(const std::size_t bytes) {
+        void* const p = reserve_aligned(bytes);
+        // best effort, the kernel may have transparent huge pages disabled
+        ::madvise(p, bytes, MADV_HUGEPAGE);
+        if constexpr (Populate)
+            populate(p, bytes);
+        return p;
+    }
+
+    // reserves bytes of address space aligned to a huge page, by mapping a huge page more and trimming both ends
+    TGP_NODISCARD static void* reserve_aligned(const std::size_t bytes) {
+        const std::size_t reserved = bytes + huge_page_size;
+        void* p = ::mmap(nullptr, reserved, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (p == MAP_FAILED)
+            TGP_TRY_THROW(std::bad_alloc());
+        auto* const first   = static_cast<char*>(p);
+        auto* const aligned = first + (huge_page_size - reinterpret_cast<std::uintptr_t>(p) % huge_page_size) %
+                                      huge_page_size;
+        if (aligned != first)
+            ::munmap(first, static_cast<std::size_t>(aligned - first));
+        if (aligned + bytes != first + reserved)
+            ::munmap(aligned + bytes, static_cast<std::size_t>(first + reserved - aligned - bytes));
+        return aligned;
+    }
+
+    static void populate(void* p, const std::size_t bytes) noexcept {
+#ifdef MADV_POPULATE_WRITE
+        if (::madvise(p, bytes, MADV_POPULATE_WRITE) == 0)
+            return;
+#endif
+        // older kernels, write one byte per page
+        for (std::size_t offset = 0; offset < bytes; offset += page_size())
+            static_cast<volatile char*>(p)[offset] = 0;
+    }
+    /* end of private function members */
+
+}; // end of class huge_page_allocator
+
+template<class T, class U, std::size_t ThresholdBytes, bool Populate>
+TGP_NODISCARD bool operator==(const huge_page_allocator<T, ThresholdBytes, Populate>&,
+                              const huge_page_allocator<U, ThresholdBytes, Populate>&) noexcept {
+    return true;
+}
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_HUGE_PAGE_ALLOCATOR_H
@@ -0,0 +1,385 @@
+#ifndef TSTL_INCLUDE_TGP_MEMORY_H
+#define TSTL_INCLUDE_TGP_MEMORY_H
+
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include <tgp/config.h>
+#include <tgp/type_traits.h>
+
+#if TGP_STD_VER >= 20
+#   include <ranges>
+#endif
+
+NAMESPACE_TGP_BEGIN
+
+/* begin of to_address */
+// the raw pointer behind a pointer-like object, through pointer_traits if it says how and operator-> otherwise
+template<class T>
+TGP_NODISCARD constexpr T* to_address(T* p) noexcept {
+    static_assert(!std::is_function<T>::value);
+    return p;
+}
+
+template<class Pointer, class = void>
+struct has_pointer_traits_to_address : std::false_type {};
+
+template<class Pointer>
+struct has_pointer_traits_to_address<Pointer, void_t<decltype(
+    std::pointer_traits<Pointer>::to_address(std::declval<const Pointer&>()))>> : std::true_type {};
+
+template<class Pointer>
+TGP_NODISCARD constexpr auto to_address(const Pointer& p) noexcept {
+    if constexpr (has_pointer_traits_to_address<Pointer>::value)
+        return std::pointer_traits<Pointer>::to_address(p);
+    else
+        return tgp::to_address(p.operator->());
+}
+/* end of to_address */
+
+
+/* begin of default_init_t */
+// selects the overloads that default-initialize new elements instead of value-initializing them
+struct default_init_t {
+    explicit default_init_t() = default;
+};
+
+inline constexpr default_init_t default_init{};
+/* end of default_init_t */
+
+
+#if TGP_STD_VER >= 20
+/* begin of from_range_t */
+// selects the constructors taking a range. it is the library's own tag where there is one, so std::ranges::to finds them
+#ifdef __cpp_lib_containers_ranges
+using std::from_range_t;
+using std::from_range;
+#else
+struct from_range_t {
+    explicit from_range_t() = default;
+};
+
+inline constexpr from_range_t from_range{};
+#endif
+
+template<class R, class T>
+concept container_compatible_range =
+    std::ranges::input_range<R> && std::convertible_to<std::ranges::range_reference_t<R>, T>;
+/* end of from_range_t */
+#endif
+
+
+/* begin of allocation extensions */
+template<class Pointer, class SizeType = std::size_t>
+struct allocation_result {
+    Pointer  ptr;
+    SizeType count;
+};
+
+template<class Alloc, class = void>
+struct allocator_has_allocate_at_least : std::false_type {};
+
+template<class Alloc>
+struct allocator_has_allocate_at_least<Alloc, void_t<decltype(std::declval<Alloc&>().allocate_at_least(std::size_t()))>>
+    : std::true_type {};
+
+/*
+ * optional allocator extension, growing the block at p that holds n elements to hold at least new_n elements
+ * without moving it:
+ *      size_type expand_in_place(pointer p, size_type n, size_type new_n);
+ * returns the new number of elements the block holds, or 0 if it can't be expanded.
+ */
+template<class Alloc, class = void>
+struct allocator_has_expand_in_place : std::false_type {};
+
+template<class Alloc>
+struct allocator_has_expand_in_place<Alloc, void_t<decltype(std::declval<Alloc&>().expand_in_place(
+    std::declval<typename std::allocator_traits<Alloc>::pointer>(), std::size_t(), std::size_t()))>>
+    : std::true_type {};
+
+template<class Alloc>
+inline constexpr bool allocator_has_expand_in_place_v = allocator_has_expand_in_place<Alloc>::value;
+
+/*
+ * optional allocator extension, moving the bytes of the block at p that holds n elements into a block holding
+ * at least new_n elements, which may start somewhere else (think of realloc):
+ *      allocation_result<pointer> reallocate(pointer p, size_type n, size_type new_n);
+ * containers only use it for trivially relocatable elements.
+ */
+template<class Alloc, class = void>
+struct allocator_has_reallocate : std::false_type {};
+
+template<class Alloc>
+struct allocator_has_reallocate<Alloc, void_t<decltype(std::declval<Alloc&>().reallocate(
+    std::declval<typename std::allocator_traits<Alloc>::pointer>(), std::size_t(), std::size_t()))>>
+    : std::true_type {};
+
+template<class Alloc>
+inline constexpr bool allocator_has_reallocate_v = allocator_has_reallocate<Alloc>::value;
+
+// allocates at least n elements and reports how many the block really holds, like C++23 allocate_at_least
+template<class Alloc>
+TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20
+allocation_result<typename std::allocator_traits<Alloc>::pointer, typename std::allocator_traits<Alloc>::size_type>
+allocate_at_least(Alloc& alloc, const typename std::allocator_traits<Alloc>::size_type n) {
+    if constexpr (allocator_has_allocate_at_least<Alloc>::value) {
+        auto result = alloc.allocate_at_least(n);
+        return {result.ptr, result.count};
+    } else {
+#if defined(__cpp_lib_allocate_at_least) && __cpp_lib_allocate_at_least >= 202302L
+        auto result = std::allocator_traits<Alloc>::allocate_at_least(alloc, n);
+        return {result.ptr, result.count};
+#elif defined(__cpp_lib_allocate_at_least)
+        auto result = std::allocate_at_least(alloc, n);
+        return {result.ptr, result.count};
+#else
+        return {std::allocator_traits<Alloc>::allocate(alloc, n), n};
+#endif
+    }
+}
+/* end of allocation extensions */
+
+
+/* begin of bulk construction paths */
+// value-initializing a range is a single memset
+template<class Alloc, class T>
+inline constexpr bool can_bulk_value_construct_v =
+    allocator_has_trivial_construct_v<Alloc, T> && is_zero_initializable_v<T>;
+
+// filling a range is a memset if all bytes of the value are equal, and a plain fill otherwise
+template<class Alloc, class T>
+inline constexpr bool can_bulk_fill_v =
+    allocator_has_trivial_construct_v<Alloc, T, const T&> && std::is_trivially_copyable_v<T>;
+
+// default-initializing a range of trivially default constructible elements leaves the storage untouched
+template<class Alloc, class T>
+inline constexpr bool can_skip_default_construct_v =
+    allocator_has_trivial_construct_v<Alloc, T> && std::is_trivially_default_constructible_v<T>;
+
+// copying a contiguous range of the same type is a single memcpy
+template<class Alloc, class Iter, class T>
+inline constexpr bool can_bulk_copy_v =
+    allocator_has_trivial_construct_v<Alloc, T, decltype(*std::declval<Iter&>())> &&
+    is_contiguous_iterator_v<Iter> &&
+    is_same_v<std::remove_cv_t<typename std::iterator_traits<Iter>::value_type>, T> &&
+    std::is_trivially_copyable_v<T>;
+
+template<class T>
+bool has_uniform_bytes(const T& value, unsigned char& byte) noexcept {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(std::addressof(value));
+    for (std::size_t i = 1; i < sizeof(T); ++i) {
+        if (bytes[i] != bytes[0])
+            return false;
+    }
+    byte = bytes[0];
+    return true;
+}
+/* end of bulk construction paths */
+
+
+/* begin of uninitialized algorithms */
+// all of them either construct the whole range or, if an exception is thrown, destroy what they have constructed
+template<class Alloc, class T>
+TGP_CONSTEXPR_SINCE_CXX20 void allocator_destroy(Alloc& alloc, T* first, T* last) noexcept {
+    if constexpr (!allocator_has_trivial_destroy_v<Alloc, T> || !std::is_trivially_destructible_v<T>) {
+        for (; first != last; ++first)
+            std::allocator_traits<Alloc>::destroy(alloc, first);
+    }
+}
+
+template<class Alloc, class T>
+TGP_CONSTEXPR_SINCE_CXX20 T* uninitialized_allocator_value_construct_n(Alloc& alloc, T* first, std::size_t n) {
+    if constexpr (can_bulk_value_construct_v<Alloc, T>) {
+        if (!TGP_IS_CONSTANT_EVALUATED()) {
+            if (n > 0)
+                std::memset(static_cast<void*>(first), 0, n * sizeof(T));
+            return first + n;
+        }
+    }
+    T* cur = first;
+    TGP_TRY {
+        for (; n > 0; --n, (void)++cur)
+            std::allocator_traits<Alloc>::construct(alloc, cur);
+    } TGP_CATCH (...) {
+        allocator_destroy(alloc, first, cur);
+        TGP_THROW;
+    }
+    return cur;
+}
+
+// default-initializes the elements unless the allocator has its own construct, which then decides what to do
+template<class Alloc, class T>
+TGP_CONSTEXPR_SINCE_CXX20 T* uninitialized_allocator_default_construct_n(Alloc& alloc, T* first, std::size_t n) {
+    if constexpr (can_skip_default_construct_v<Alloc, T>) {
+        if (!TGP_IS_CONSTANT_EVALUATED())
+            return first + n;
+    }
+    T* cur = first;
+    TGP_TRY {
+        for (; n > 0; --n, (void)++cur) {
+            if constexpr (allocator_has_trivial_construct_v<Alloc, T>) {
+                if (TGP_IS_CONSTANT_EVALUATED())
+                    std::allocator_traits<Alloc>::construct(alloc, cur);
+                else
+                    ::new (static_cast<void*>(cur)) T;
+            } else {
+                std::allocator_traits<Alloc>::construct(alloc, cur);
+            }
+        }
+    } TGP_CATCH (...) {
+        allocator_destroy(alloc, first, cur);
+        TGP_THROW;
+    }
+    return cur;
+}
+
+template<class Alloc, class T>
+TGP_CONSTEXPR_SINCE_CXX20 T* uninitialized_allocator_fill_n(Alloc& alloc, T* first, std::size_t n, const T& value) {
+    if constexpr (can_bulk_fill_v<Alloc, T>) {
+        if (!TGP_IS_CONSTANT_EVALUATED()) {
+            unsigned char byte;
+            if (has_uniform_bytes(value, byte)) {
+                if (n > 0)
+                    std::memset(static_cast<void*>(first), byte, n * sizeof(T));
+                return first + n;
+            }
+            return std::uninitialized_fill_n(first, n, value);
+        }
+    }
+    T* cur = first;
+    TGP_TRY {
+        for (; n > 0; --n, (void)++cur)
+            std::allocator_traits<Alloc>::construct(alloc, cur, value);
+    } TGP_CATCH (...) {
+        allocator_destroy(alloc, first, cur);
+        TGP_THROW;
+    }
+    return cur;
+}
+
+template<class Alloc, class InputIt, class T>
+TGP_CONSTEXPR_SINCE_CXX20 T* uninitialized_allocator_copy(Alloc& alloc, InputIt first, InputIt last, T* result) {
+    if constexpr (can_bulk_copy_v<Alloc, InputIt, T>) {
+        if (!TGP_IS_CONSTANT_EVALUATED()) {
+            const auto n = static_cast<std::size_t>(last - first);
+            if (n > 0)
+                std::memcpy(static_cast<void*>(result), static_cast<const void*>(tgp::to_address(first)), n * sizeof(T));
+            return result + n;
+        }
+    }
+    T* cur = result;
+    TGP_TRY {
+        for (; first != last; ++first, (void)++cur)
+            std::allocator_traits<Alloc>::construct(alloc, cur, *first);
+    } TGP_CATCH (...) {
+        allocator_destroy(alloc, result, cur);
+        TGP_THROW;
+    }
+    return cur;
+}
+/* end of uninitialized algorithms */
+
+
+/* begin of relocation */
+/*
+ * relocates [first, last) into the uninitialized storage at result, the two ranges must not overlap.
+ * afterwards [first, last) holds no object anymore.
+ * trivially relocatable elements are copied with a single memcpy. the others are moved if their move
+ * constructor is noexcept and copied otherwise, so that an exception leaves [first, last) untouched.
+ */
+template<class Alloc, class T>
+TGP_CONSTEXPR_SINCE_CXX20 void uninitialized_allocator_relocate(Alloc& alloc, T* first, T* last, T* result) {
+    if constexpr (is_trivially_allocator_relocatable_v<Alloc, T>) {
+        if (!TGP_IS_CONSTANT_EVALUATED()) {
+            if (first != last)
+                std::memcpy(static_cast<void*>(result), static_cast<const void*>(first),
+                            static_cast<std::size_t>(last - first) * sizeof(T));
+            return;
+        }
+    }
+    T* cur = result;
+    TGP_TRY {
+        for (T* p = first; p != last; ++p, (void)++cur)
+            std::allocator_traits<Alloc>::construct(alloc, cur, std::move_if_noexcept(*p));
+    } TGP_CATCH (...) {
+        allocator_destroy(alloc, result, cur);
+        TGP_THROW;
+    }
+    allocator_destroy(alloc, first, last);
+}
+
+/*
+ * relocates [first, last) to result inside one buffer, the two ranges may overlap.
+ * only for trivially relocatable elements, the vacated slots are left uninitialized.
+ */
+template<class Alloc, class T>
+TGP_CONSTEXPR_SINCE_CXX20 void allocator_trivially_relocate(Alloc& alloc, T* first, T* last, T* result) noexcept {
+    static_assert(is_trivially_allocator_relocatable_v<Alloc, T>);
+    if (TGP_IS_CONSTANT_EVALUATED()) {
+        using alloc_traits = std::allocator_traits<Alloc>;
+        if (result < first) {
+            for (; first != last; ++first, (void)++result) {
+                alloc_traits::construct(alloc, result, std::move(*first));
+                alloc_traits::destroy(alloc, first);
+            }
+        } else if (first < result) {
+            for (result += last - first; first != last;) {
+                alloc_traits::construct(alloc, --result, std::move(*--last));
+                alloc_traits::destroy(alloc, last);
+            }
+        }
+    } else if (first != last) {
+        std::memmove(static_cast<void*>(result), static_cast<const void*>(first),
+                     static_cast<std::size_t>(last - first) * sizeof(T));
+    }
+}
+/* end of relocation */
+
+
+/* begin of temp_value */
+// an element constructed through the allocator before the container makes room for it
+template<class T, class Alloc>
+struct temp_value {
+    using alloc_traits = std::allocator_traits<Alloc>;
+
+    union { T value_; };
+    Alloc& alloc_;
+    bool alive_ = true;
+
+    temp_value(const temp_value&)            = delete;
+    temp_value& operator=(const temp_value&) = delete;
+
+    template<class... Args>
+    TGP_CONSTEXPR_SINCE_CXX20 explicit temp_value(Alloc& alloc, Args&&... args)
+        : alloc_(alloc) {
+        alloc_traits::construct(alloc_, std::addressof(value_), std::forward<Args>(args)...);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 ~temp_value() {
+        if (alive_)
+            alloc_traits::destroy(alloc_, std::addressof(value_));
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 T& get() noexcept {
+        return value_;
+    }
+
+    // relocates the value into the uninitialized storage at p, only for trivially relocatable elements
+    TGP_CONSTEXPR_SINCE_CXX20 void relocate_to(T* p) noexcept {
+        // the value and p are no part of one array, which constant evaluation cannot compare
+        if (TGP_IS_CONSTANT_EVALUATED()) {
+            alloc_traits::construct(alloc_, p, std::move(value_));
+            alloc_traits::destroy(alloc_, std::addressof(value_));
+        } else {
+            allocator_trivially_relocate(alloc_, std::addressof(value_), std::addressof(value_) + 1, p);
+        }
+        alive_ = false;
+    }
+};
+/* end of temp_value */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_MEMORY_H
@@ -0,0 +1,442 @@
+#ifndef TSTL_INCLUDE_TGP_MMAP_VECTOR_H
+#define TSTL_INCLUDE_TGP_MMAP_VECTOR_H
+
+#if !defined(__linux__)
+#   error "tgp/mmap_vector.h requires linux mremap"
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <tgp/compare.h>
+#include <tgp/config.h>
+#include <tgp/exception.h>
+#include <tgp/growth_policy.h>
+#include <tgp/page.h>
+
+NAMESPACE_TGP_BEGIN
+
+enum class mmap_mode {
+    read_only,
+    read_write
+};
+
+/*
+ * a vector of trivially copyable elements living in a shared mapping of a file, so opening it takes O(1)
+ * whatever its size and pages are read in as they are touched. the file holds a 64-byte header with the
+ * element size and the number of elements, followed by the elements and the spare capacity.
+ * it grows by extending the file and remapping it. changes reach the file when the kernel writes the pages
+ * back, sync() waits for that.
+ */
+template<class T, class GrowthPolicy = double_growth>
+class mmap_vector {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    struct header {
+        std::uint64_t magic;
+        std::uint64_t element_size;
+        std::uint64_t size;
+        std::uint64_t reserved[5];
+    };
+
+    // tells the files of mmap_vector apart from anything else
+    static constexpr std::uint64_t magic = 0x7467'706d'6d76'6563;
+
+    static_assert(sizeof(header) == 64 && alignof(T) <= sizeof(header));
+
+public:
+    /* begin of public alias members */
+    using value_type                = T;
+    using growth_policy             = GrowthPolicy;
+    using size_type                 = size_t;
+    using difference_type           = ptrdiff_t;
+    using reference                 = value_type&;
+    using const_reference           = const value_type&;
+    using pointer                   = value_type*;
+    using const_pointer             = const value_type*;
+    using iterator                  = pointer;
+    using const_iterator            = const_pointer;
+    using reverse_iterator          = std::reverse_iterator<iterator>;
+    using const_reverse_iterator    = std::reverse_iterator<const_iterator>;
+    /* end of public alias members */
+
+
+    /* begin of constructor and destructor */
+    // opens the file at path, creating an empty one if it does not exist and mode is read_write
+    explicit mmap_vector(const char* path, const mmap_mode mode = mmap_mode::read_write)
+        : writable_(mode == mmap_mode::read_write) {
+        TGP_TRY {
+            open(path);
+        } TGP_CATCH (...) {
+            close();
+            TGP_THROW;
+        }
+    }
+
+    mmap_vector(const mmap_vector&) = delete;
+
+    mmap_vector(mmap_vector&& other) noexcept {
+        swap(other);
+    }
+
+    ~mmap_vector() {
+        close();
+    }
+    /* end of constructor and destructor */
+
+
+    /* begin of element access */
+    TGP_NODISCARD reference operator[] (const size_type pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
+        return data()[pos];
+    }
+
+    TGP_NODISCARD const_reference operator[] (const size_type pos) const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
+        return data()[pos];
+    }
+
+    TGP_NODISCARD reference at(const size_type pos) {
+        if (pos >= size())
+            TGP_TRY_THROW(std::out_of_range("tgp::mmap_vector::at element access out of range"));
+        return data()[pos];
+    }
+
+    TGP_NODISCARD const_reference at(const size_type pos) const {
+        if (pos >= size())
+            TGP_TRY_THROW(std::out_of_range("tgp::mmap_vector::at element access out of range"));
+        return data()[pos];
+    }
+
+    TGP_NODISCARD reference front() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *data();
+    }
+
+    TGP_NODISCARD const_reference front() const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return *data();
+    }
+
+    TGP_NODISCARD reference back() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return data()[size() - 1];
+    }
+
+    TGP_NODISCARD const_reference back() const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return data()[size() - 1];
+    }
+
+    TGP_NODISCARD value_type* data() noexcept {
+        return map_ ? reinterpret_cast<value_type*>(map_ + sizeof(header)) : nullptr;
+    }
+
+    TGP_NODISCARD const value_type* data() const noexcept {
+        return map_ ? reinterpret_cast<const value_type*>(map_ + sizeof(header)) : nullptr;
+    }
+    /* end of element access */
+
+
+    /* begin of iterators */
+    TGP_NODISCARD iterator begin() noexcept {
+        return data();
+    }
+
+    TGP_NODISCARD const_iterator begin() const noexcept {
+        return data();
+    }
+
+    TGP_NODISCARD const_iterator cbegin() const noexcept {
+        return data();
+    }
+
+    TGP_NODISCARD iterator end() noexcept {
+        return data() + size();
+    }
+
+    TGP_NODISCARD const_iterator end() const noexcept {
+        return data() + size();
+    }
+
+    TGP_NODISCARD const_iterator cend() const noexcept {
+        return data() + size();
+    }
+
+    TGP_NODISCARD reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    TGP_NODISCARD const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    TGP_NODISCARD const_reverse_iterator crbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    TGP_NODISCARD reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD const_reverse_iterator crend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    TGP_NODISCARD bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    TGP_NODISCARD size_type size() const noexcept {
+        return map_ ? static_cast<size_type>(header_of()->size) : 0;
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return (static_cast<size_type>(PTRDIFF_MAX) - sizeof(header)) / sizeof(value_type);
+    }
+
+    TGP_NODISCARD size_type capacity() const noexcept {
+        return map_ ? (map_size_ - sizeof(header)) / sizeof(value_type) : 0;
+    }
+
+    TGP_NODISCARD bool writable() const noexcept {
+        return writable_;
+    }
+
+    void reserve(const size_type new_cap) {
+        check_writable("tgp::mmap_vector::reserve on a read-only mapping");
+        if (new_cap > capacity()) {
+            if (new_cap > max_size())
+                TGP_TRY_THROW(std::length_error("tgp::mmap_vector::reserve new capacity exceeds max_size"));
+            remap(file_size_for(new_cap));
+        }
+    }
+
+    // gives the pages past the last element back to the file system
+    void shrink_to_fit() {
+        check_writable("tgp::mmap_vector::shrink_to_fit on a read-only mapping");
+        const std::size_t new_size = file_size_for(size());
+        if (new_size < map_size_)
+            remap(new_size);
+    }
+    /* end of capacity */
+
+
+    /* begin of modifiers */
+    void clear() {
+        check_writable("tgp::mmap_vector::clear on a read-only mapping");
+        header_of()->size = 0;
+    }
+
+    void push_back(const value_type& value) {
+        emplace_back(value);
+    }
+
+    template<class... Args>
+    reference emplace_back(Args&&... args) {
+        check_writable("tgp::mmap_vector::emplace_back on a read-only mapping");
+        const size_type cur_size = size();
+        if (cur_size == capacity()) {
+            // the argument may live in the mapping, which moves when it grows
+            value_type value(std::forward<Args>(args)...);
+            remap(file_size_for(recommend_cap(cur_size + 1)));
+            ::new (static_cast<void*>(data() + cur_size)) value_type(value);
+        } else {
+            ::new (static_cast<void*>(data() + cur_size)) value_type(std::forward<Args>(args)...);
+        }
+        header_of()->size = cur_size + 1;
+        return data()[cur_size];
+    }
+
+    void pop_back() {
+        check_writable("tgp::mmap_vector::pop_back on a read-only mapping");
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        --header_of()->size;
+    }
+
+    void resize(const size_type count) {
+        resize_impl(count, [this](const size_type first, const size_type n) {
+            std::uninitialized_value_construct_n(data() + first, n);
+        });
+    }
+
+    void resize(const size_type count, const value_type& value) {
+        const value_type copy = value;
+        resize_impl(count, [this, &copy](const size_type first, const size_type n) {
+            std::uninitialized_fill_n(data() + first, n, copy);
+        });
+    }
+
+    template<class ForwardIt, enable_if_t<has_forward_iterator_category<ForwardIt>::value, int> = 0>
+    void assign(ForwardIt first, ForwardIt last) {
+        check_writable("tgp::mmap_vector::assign on a read-only mapping");
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        header_of()->size = 0;
+        reserve(count);
+        std::uninitialized_copy(first, last, data());
+        header_of()->size = count;
+    }
+
+    void swap(mmap_vector& other) noexcept {
+        using std::swap;
+        swap(fd_, other.fd_);
+        swap(map_, other.map_);
+        swap(map_size_, other.map_size_);
+        swap(writable_, other.writable_);
+    }
+    /* end of modifiers */
+
+
+    /* begin of miscellaneous */
+    mmap_vector& operator=(const mmap_vector&) = delete;
+
+    mmap_vector& operator=(mmap_vector&& other) noexcept {
+        mmap_vector(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    // writes the changes back to the file and waits for them to be durable
+    void sync() {
+        if (map_ && writable_ && ::msync(map_, map_size_, MS_SYNC) != 0)
+            throw_system_error("tgp::mmap_vector::sync msync");
+    }
+    /* end of miscellaneous */
+
+private:
+    /* begin of private data members */
+    int         fd_       = -1;
+    char*       map_      = nullptr;
+    std::size_t map_size_ = 0;
+    bool        writable_ = false;
+    /* end of private data members */
+
+
+    /* begin of private function members */
+    [[noreturn]] static void throw_system_error(const char* what) {
+        TGP_TRY_THROW(std::system_error(errno, std::generic_category(), what));
+    }
+
+    // the pages of a read-only mapping can't be written, so every modifier checks whatever the hardening mode
+    void check_writable(const char* what) const {
+        if (!writable_)
+            TGP_TRY_THROW(std::logic_error(what));
+    }
+
+    TGP_NODISCARD header* header_of() const noexcept {
+        return reinterpret_cast<header*>(map_);
+    }
+
+    TGP_NODISCARD static std::size_t file_size_for(const size_type cap) noexcept {
+        return round_up_to_page(sizeof(header) + cap * sizeof(value_type));
+    }
+
+    TGP_NODISCARD size_type recommend_cap(const size_type new_size) const {
+        const size_type ms = max_size();
+        if (new_size > ms)
+            TGP_TRY_THROW(std::length_error("tgp::mmap_vector::recommend_cap new size exceeds max_size"));
+        return growth_policy::recommend(capacity(), new_size, ms, sizeof(value_type));
+    }
+
+    void open(const char* path) {
+        fd_ = ::open(path, writable_ ? O_RDWR | O_CREAT | O_CLOEXEC : O_RDONLY | O_CLOEXEC, 0644);
+        if (fd_ < 0)
+            throw_system_error("tgp::mmap_vector open");
+        struct stat st;
+        if (::fstat(fd_, &st) != 0)
+            throw_system_error("tgp::mmap_vector fstat");
+
+        auto file_size = static_cast<std::size_t>(st.st_size);
+        const bool fresh = file_size == 0 && writable_;
+        if (fresh) {
+            file_size = file_size_for(0);
+            if (::ftruncate(fd_, static_cast<off_t>(file_size)) != 0)
+                throw_system_error("tgp::mmap_vector ftruncate");
+        }
+        if (file_size < sizeof(header))
+            TGP_TRY_THROW(std::runtime_error("tgp::mmap_vector file too small for its header"));
+
+        void* p = ::mmap(nullptr, file_size, writable_ ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd_, 0);
+        if (p == MAP_FAILED)
+            throw_system_error("tgp::mmap_vector mmap");
+        map_      = static_cast<char*>(p);
+        map_size_ = file_size;
+
+        header* h = header_of();
+        if (fresh) {
+            h->magic        = magic;
+            h->element_size = sizeof(value_type);
+            h->size         = 0;
+        } else if (h->magic != magic || h->element_size != sizeof(value_type) || h->size > capacity()) {
+            TGP_TRY_THROW(std::runtime_error("tgp::mmap_vector file does not hold a vector of this type"));
+        }
+    }
+
+    void close() noexcept {
+        if (map_)
+            ::munmap(map_, map_size_);
+        if (fd_ >= 0)
+            ::close(fd_);
+        map_ = nullptr;
+        fd_  = -1;
+    }
+
+    // resizes the file and its mapping, growing the file before the mapping and shrinking it after
+    void remap(const std::size_t new_size) {
+        if (new_size > map_size_ && ::ftruncate(fd_, static_cast<off_t>(new_size)) != 0)
+            throw_system_error("tgp::mmap_vector ftruncate");
+        void* p = ::mremap(map_, map_size_, new_size, MREMAP_MAYMOVE);
+        if (p == MAP_FAILED)
+            throw_system_error("tgp::mmap_vector mremap");
+        map_      = static_cast<char*>(p);
+        map_size_ = new_size;
+        // a failure to shrink the file only leaves spare pages in it
+        static_cast<void>(::ftruncate(fd_, static_cast<off_t>(new_size)));
+    }
+
+    template<class Construct>
+    void resize_impl(const size_type count, Construct construct) {
+        check_writable("tgp::mmap_vector::resize on a read-only mapping");
+        const size_type cur_size = size();
+        if (count > cur_size) {
+            if (count > capacity())
+                remap(file_size_for(recommend_cap(count)));
+            construct(cur_size, count - cur_size);
+        }
+        header_of()->size = count;
+    }
+    /* end of private function members */
+
+}; // end of class mmap_vector
+
+NAMESPACE_TGP_END
+
+namespace std {
+
+template<class T, class GrowthPolicy>
+void swap(tgp::mmap_vector<T, GrowthPolicy>& lhs, tgp::mmap_vector<T, GrowthPolicy>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+} // end of namespace std
+
+#endif // end of TSTL_INCLUDE_TGP_MMAP_VECTOR_H
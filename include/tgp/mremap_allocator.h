@@ -0,0 +1,98 @@
+#ifndef TSTL_INCLUDE_TGP_MREMAP_ALLOCATOR_H
+#define TSTL_INCLUDE_TGP_MREMAP_ALLOCATOR_H
+
+#if !defined(__linux__)
+#   error "tgp/mremap_allocator.h requires linux mremap"
+#endif
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include <tgp/config.h>
+#include <tgp/exception.h>
+#include <tgp/memory.h>
+#include <tgp/page.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * an allocator handing out whole pages of anonymous memory. blocks grow with mremap, in place when
+ * the following address space is free and by remapping the pages elsewhere otherwise, so that a
+ * vector of trivially relocatable elements never copies them when it grows.
+ * meant for vectors of several GB, every allocation takes at least one page.
+ */
+template<class T>
+class mremap_allocator {
+public:
+    /* begin of public alias members */
+    using value_type                             = T;
+    using size_type                              = std::size_t;
+    using difference_type                        = std::ptrdiff_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal                        = std::true_type;
+    /* end of public alias members */
+
+
+    /* begin of function members */
+    mremap_allocator() noexcept = default;
+
+    template<class U>
+    mremap_allocator(const mremap_allocator<U>&) noexcept {}
+
+    TGP_NODISCARD T* allocate(const size_type n) {
+        return allocate_at_least(n).ptr;
+    }
+
+    TGP_NODISCARD allocation_result<T*> allocate_at_least(const size_type n) {
+        const std::size_t bytes = bytes_of(n);
+        void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED)
+            TGP_TRY_THROW(std::bad_alloc());
+        return {static_cast<T*>(p), bytes / sizeof(T)};
+    }
+
+    void deallocate(T* p, const size_type n) noexcept {
+        ::munmap(p, bytes_of(n));
+    }
+
+    size_type expand_in_place(T* p, const size_type n, const size_type new_n) noexcept {
+        const std::size_t bytes = bytes_of(new_n);
+        if (::mremap(p, bytes_of(n), bytes, 0) == MAP_FAILED)
+            return 0;
+        return bytes / sizeof(T);
+    }
+
+    TGP_NODISCARD allocation_result<T*> reallocate(T* p, const size_type n, const size_type new_n) {
+        const std::size_t bytes = bytes_of(new_n);
+        void* q = ::mremap(p, bytes_of(n), bytes, MREMAP_MAYMOVE);
+        if (q == MAP_FAILED)
+            TGP_TRY_THROW(std::bad_alloc());
+        return {static_cast<T*>(q), bytes / sizeof(T)};
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return static_cast<size_type>(PTRDIFF_MAX) / sizeof(T);
+    }
+    /* end of function members */
+
+private:
+    /* begin of private function members */
+    TGP_NODISCARD static std::size_t bytes_of(const size_type n) {
+        return round_up_to_page(n * sizeof(T));
+    }
+    /* end of private function members */
+
+}; // end of class mremap_allocator
+
+template<class T, class U>
+TGP_NODISCARD bool operator==(const mremap_allocator<T>&, const mremap_allocator<U>&) noexcept {
+    return true;
+}
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_MREMAP_ALLOCATOR_H
@@ -0,0 +1,39 @@
+#ifndef TSTL_INCLUDE_TGP_PAGE_H
+#define TSTL_INCLUDE_TGP_PAGE_H
+
+#if __has_include(<unistd.h>)
+#   include <unistd.h>
+#endif
+
+#include <cstddef>
+
+#include <tgp/config.h>
+
+NAMESPACE_TGP_BEGIN
+
+/* begin of page helpers */
+TGP_NODISCARD inline std::size_t page_size() noexcept {
+#ifdef _SC_PAGESIZE
+    static const auto size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+// rounds up to a multiple of alignment, a power of two, and takes at least one
+TGP_NODISCARD inline std::size_t round_up_to(const std::size_t bytes, const std::size_t alignment) noexcept {
+    return bytes == 0 ? alignment : (bytes + alignment - 1) & ~(alignment - 1);
+}
+
+TGP_NODISCARD inline std::size_t round_up_to_page(const std::size_t bytes) noexcept {
+    return round_up_to(bytes, page_size());
+}
+
+// the size of a transparent huge page, which is a PMD mapping on x86-64 and on aarch64 with 4 KB pages
+inline constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+/* end of page helpers */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_PAGE_H
@@ -0,0 +1,439 @@
+#ifndef TSTL_INCLUDE_TGP_RECYCLING_ALLOCATOR_H
+#define TSTL_INCLUDE_TGP_RECYCLING_ALLOCATOR_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <tgp/config.h>
+#include <tgp/exception.h>
+#include <tgp/memory.h>
+
+NAMESPACE_TGP_BEGIN
+
+/* begin of recycling size classes */
+inline constexpr std::size_t recycling_class_count = 73;
+
+// the size class of a block of bytes, four per power of two from 64 bytes up to 16 MiB
+TGP_NODISCARD constexpr std::size_t recycling_size_class(const std::size_t bytes) noexcept {
+    if (bytes <= 64)
+        return 0;
+    // (2^(b-1), 2^b] split into four classes
+    const auto b = static_cast<std::size_t>(std::bit_width(bytes - 1));
+    const std::size_t spacing = std::size_t(1) << (b - 3);
+    const std::size_t steps   = (bytes - (std::size_t(1) << (b - 1)) + spacing - 1) / spacing;
+    return (b - 7) * 4 + steps;
+}
+
+TGP_NODISCARD constexpr std::size_t recycling_class_bytes(const std::size_t size_class) noexcept {
+    if (size_class == 0)
+        return 64;
+    const std::size_t b = (size_class - 1) / 4 + 7;
+    return (std::size_t(1) << (b - 1)) + ((size_class - 1) % 4 + 1) * (std::size_t(1) << (b - 3));
+}
+static_assert(recycling_class_bytes(recycling_class_count - 1) == std::size_t(1) << 24);
+/* end of recycling size classes */
+
+
+/* begin of recycling_cache */
+struct recycling_limits {
+    std::size_t max_cached_bytes  = std::size_t(8) << 20; // bytes a thread keeps in its free lists
+    std::size_t max_block_bytes   = std::size_t(1) << 20; // larger blocks go back to operator delete
+    std::size_t remote_batch_size = 32;                   // blocks of another thread handed back at once
+};
+
+// counts of the calling thread
+struct recycling_stats {
+    std::uint64_t hits                   = 0; // allocations served from the free lists
+    std::uint64_t upstream_allocations   = 0;
+    std::uint64_t upstream_deallocations = 0;
+    std::uint64_t remote_batches         = 0; // batches handed to the threads owning the blocks
+};
+
+/*
+ * the per-thread block cache behind recycling_allocator. blocks up to max_class_bytes are rounded up to
+ * one of four size classes per power of two and carry a small header naming the thread that allocated them.
+ * a block freed on its own thread goes to that thread's free list of its class, as long as the byte caps
+ * allow. a block freed on another thread is collected with others of the same owner and handed back in a
+ * batch with a single compare-and-swap; the owner takes the batches in when a free list runs dry.
+ * a thread that stops freeing should call flush() so its pending batches do not wait for its exit.
+ * a cache outlives its thread until the last of its blocks is freed.
+ * all member functions act on the calling thread's cache, get it with local().
+ */
+class recycling_cache {
+    struct alignas(std::max_align_t) block_header {
+        // a block linked into a free list, a batch or an inbox is owned by the cache holding the list
+        union {
+            recycling_cache* owner;
+            block_header*    next;
+        };
+        std::size_t size_class;
+    };
+
+    struct remote_batch {
+        recycling_cache* owner = nullptr;
+        block_header*    head  = nullptr;
+        block_header*    tail  = nullptr;
+        std::size_t      count = 0;
+    };
+
+    struct thread_holder {
+        thread_holder() noexcept {
+            current_ = new (std::nothrow) recycling_cache;
+        }
+
+        ~thread_holder() {
+            recycling_cache* cache = std::exchange(current_, nullptr);
+            exited_ = true;
+            if (cache)
+                cache->detach();
+        }
+    };
+
+public:
+    static constexpr std::size_t header_size     = sizeof(block_header);
+    static constexpr std::size_t max_class_bytes = recycling_class_bytes(recycling_class_count - 1);
+
+    /* begin of function members */
+    recycling_cache(const recycling_cache&)            = delete;
+    recycling_cache& operator=(const recycling_cache&) = delete;
+
+    // the calling thread's cache, created on first use
+    TGP_NODISCARD static recycling_cache& local() {
+        recycling_cache* cache = this_thread();
+        if (!cache)
+            TGP_TRY_THROW(std::bad_alloc());
+        return *cache;
+    }
+
+    // a block of at least bytes aligned to max_align_t, and the bytes it really holds
+    TGP_NODISCARD static allocation_result<void*> allocate(const std::size_t bytes) {
+        if (bytes > max_class_bytes - header_size)
+            return {::operator new(bytes), bytes};
+        const std::size_t size_class = recycling_size_class(bytes + header_size);
+        const std::size_t usable     = recycling_class_bytes(size_class) - header_size;
+        recycling_cache* cache = this_thread();
+        block_header* h = cache ? cache->pop(size_class) : nullptr;
+        if (!h) {
+            h = static_cast<block_header*>(::operator new(recycling_class_bytes(size_class)));
+            h->size_class = size_class;
+            h->owner      = cache;
+            if (cache) {
+                cache->refs_.fetch_add(1, std::memory_order_relaxed);
+                ++cache->stats_.upstream_allocations;
+            }
+        }
+        return {h + 1, usable};
+    }
+
+    // bytes may be anything between what allocate was asked for and what it returned
+    static void deallocate(void* p, const std::size_t bytes) noexcept {
+        if (bytes > max_class_bytes - header_size) {
+            ::operator delete(p, bytes);
+            return;
+        }
+        block_header* h = static_cast<block_header*>(p) - 1;
+        recycling_cache* owner = h->owner;
+        if (!owner) {
+            destroy_block(h, nullptr);
+            return;
+        }
+        recycling_cache* cache = this_thread();
+        if (owner == cache)
+            cache->keep_or_destroy(h);
+        else if (cache)
+            cache->defer_remote(owner, h);
+        else
+            push_batch(owner, h, h);
+    }
+
+    TGP_NODISCARD const recycling_limits& limits() const noexcept {
+        return limits_;
+    }
+
+    // lowering the caps frees the blocks over them right away
+    void set_limits(const recycling_limits& limits) noexcept {
+        limits_ = limits;
+        if (limits_.remote_batch_size == 0)
+            limits_.remote_batch_size = 1;
+        for (std::size_t i = recycling_class_count; i-- > 0;) {
+            if (recycling_class_bytes(i) <= limits_.max_block_bytes)
+                break;
+            release_class(i);
+        }
+        trim(limits_.max_cached_bytes);
+    }
+
+    // hands the pending batches to their owners, takes in the blocks other threads handed back and
+    // frees cached blocks, the largest first, until at most keep_bytes remain
+    void trim(const std::size_t keep_bytes = 0) noexcept {
+        flush();
+        collect_inbox();
+        for (std::size_t i = recycling_class_count; i-- > 0 && cached_bytes_ > keep_bytes;) {
+            while (free_lists_[i] && cached_bytes_ > keep_bytes) {
+                block_header* h = free_lists_[i];
+                free_lists_[i] = h->next;
+                cached_bytes_ -= recycling_class_bytes(i);
+                h->owner = this;
+                destroy_block(h, this);
+            }
+        }
+    }
+
+    // hands the pending batches to their owners
+    void flush() noexcept {
+        for (auto& batch : batches_)
+            flush_batch(batch);
+    }
+
+    TGP_NODISCARD std::size_t cached_bytes() const noexcept {
+        return cached_bytes_;
+    }
+
+    TGP_NODISCARD const recycling_stats& stats() const noexcept {
+        return stats_;
+    }
+
+    void reset_stats() noexcept {
+        stats_ = recycling_stats();
+    }
+
+    /* end of function members */
+
+private:
+    /* begin of private data members */
+    static constexpr std::size_t batch_slots = 4;
+
+    static inline thread_local recycling_cache* current_ = nullptr;
+    static inline thread_local bool             exited_  = false;
+
+    block_header*              free_lists_[recycling_class_count] = {};
+    std::size_t                cached_bytes_            = 0;
+    recycling_limits           limits_;
+    recycling_stats            stats_;
+    remote_batch               batches_[batch_slots];
+    std::size_t                next_slot_ = 0;
+    std::atomic<block_header*> inbox_{nullptr};
+    // one for the thread and one per block alive
+    std::atomic<std::size_t>   refs_{1};
+    /* end of private data members */
+
+
+    /* begin of private function members */
+    recycling_cache() noexcept = default;
+
+    // nullptr while the thread's storage is being destroyed, or if the cache could not be created
+    TGP_NODISCARD static recycling_cache* this_thread() noexcept {
+        if (current_) TGP_LIKELY
+            return current_;
+        if (exited_)
+            return nullptr;
+        static thread_local thread_holder holder;
+        return current_;
+    }
+
+    // an inbox that takes no more batches, never dereferenced
+    TGP_NODISCARD static block_header* closed() noexcept {
+        return reinterpret_cast<block_header*>(alignof(block_header));
+    }
+
+    TGP_NODISCARD block_header* pop(const std::size_t size_class) noexcept {
+        if (!free_lists_[size_class] && inbox_.load(std::memory_order_relaxed))
+            collect_inbox();
+        block_header* h = free_lists_[size_class];
+        if (!h)
+            return nullptr;
+        free_lists_[size_class] = h->next;
+        cached_bytes_ -= recycling_class_bytes(size_class);
+        h->owner = this;
+        ++stats_.hits;
+        return h;
+    }
+
+    void keep_or_destroy(block_header* h) noexcept {
+        const std::size_t bytes = recycling_class_bytes(h->size_class);
+        if (bytes > limits_.max_block_bytes || cached_bytes_ + bytes > limits_.max_cached_bytes) {
+            destroy_block(h, this);
+            return;
+        }
+        h->next = free_lists_[h->size_class];
+        free_lists_[h->size_class] = h;
+        cached_bytes_ += bytes;
+    }
+
+    void collect_inbox() noexcept {
+        block_header* h = inbox_.exchange(nullptr, std::memory_order_acquire);
+        while (h) {
+            block_header* next = h->next;
+            h->owner = this;
+            keep_or_destroy(h);
+            h = next;
+        }
+    }
+
+    void release_class(const std::size_t size_class) noexcept {
+        while (block_header* h = free_lists_[size_class]) {
+            free_lists_[size_class] = h->next;
+            cached_bytes_ -= recycling_class_bytes(size_class);
+            h->owner = this;
+            destroy_block(h, this);
+        }
+    }
+
+    void defer_remote(recycling_cache* owner, block_header* h) noexcept {
+        remote_batch* batch = nullptr;
+        for (auto& b : batches_) {
+            if (b.owner == owner) {
+                batch = &b;
+                break;
+            }
+            if (!batch && !b.owner)
+                batch = &b;
+        }
+        if (!batch) {
+            // all slots taken by other owners, evict one round robin
+            batch = &batches_[next_slot_];
+            next_slot_ = (next_slot_ + 1) % batch_slots;
+            flush_batch(*batch);
+        }
+        batch->owner = owner;
+        h->next = batch->head;
+        if (!batch->head)
+            batch->tail = h;
+        batch->head = h;
+        if (++batch->count >= limits_.remote_batch_size)
+            flush_batch(*batch);
+    }
+
+    void flush_batch(remote_batch& batch) noexcept {
+        if (!batch.owner)
+            return;
+        push_batch(batch.owner, batch.head, batch.tail);
+        ++stats_.remote_batches;
+        batch = remote_batch();
+    }
+
+    // links [head, tail] into the owner's inbox, or frees the blocks if the owner's thread is gone
+    static void push_batch(recycling_cache* owner, block_header* head, block_header* tail) noexcept {
+        block_header* top = owner->inbox_.load(std::memory_order_relaxed);
+        do {
+            if (top == closed()) {
+                tail->next = nullptr;
+                while (head) {
+                    block_header* next = head->next;
+                    head->owner = owner;
+                    destroy_block(head, this_thread());
+                    head = next;
+                }
+                return;
+            }
+            tail->next = top;
+        } while (!owner->inbox_.compare_exchange_weak(top, head, std::memory_order_release,
+                                                      std::memory_order_relaxed));
+    }
+
+    // hands the block back to operator delete, cache is the calling thread's for the counts
+    static void destroy_block(block_header* h, recycling_cache* cache) noexcept {
+        recycling_cache* owner = h->owner;
+        ::operator delete(h, recycling_class_bytes(h->size_class));
+        if (cache)
+            ++cache->stats_.upstream_deallocations;
+        if (owner)
+            owner->release();
+    }
+
+    void release() noexcept {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete this;
+    }
+
+    // on thread exit, frees everything cached and lets the blocks still alive free the cache
+    void detach() noexcept {
+        block_header* h = inbox_.exchange(closed(), std::memory_order_acquire);
+        while (h) {
+            block_header* next = h->next;
+            h->owner = this;
+            destroy_block(h, nullptr);
+            h = next;
+        }
+        for (auto& batch : batches_) {
+            if (batch.owner)
+                push_batch(batch.owner, batch.head, batch.tail);
+        }
+        for (std::size_t i = 0; i < recycling_class_count; ++i)
+            release_class(i);
+        release();
+    }
+    /* end of private function members */
+
+}; // end of class recycling_cache
+/* end of recycling_cache */
+
+
+/* begin of recycling_allocator */
+/*
+ * an allocator drawing from the calling thread's recycling_cache, for containers that keep growing through
+ * the same capacities, e.g. the vectors a request handler builds and drops on every request. once the
+ * caches are warm, such a request allocates nothing from operator new. blocks may be freed on any thread.
+ * over-aligned types bypass the cache.
+ */
+template<class T>
+class recycling_allocator {
+public:
+    /* begin of public alias members */
+    using value_type                             = T;
+    using size_type                              = std::size_t;
+    using difference_type                        = std::ptrdiff_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal                        = std::true_type;
+    /* end of public alias members */
+
+
+    /* begin of function members */
+    recycling_allocator() noexcept = default;
+
+    template<class U>
+    recycling_allocator(const recycling_allocator<U>&) noexcept {}
+
+    TGP_NODISCARD T* allocate(const size_type n) {
+        return allocate_at_least(n).ptr;
+    }
+
+    TGP_NODISCARD allocation_result<T*> allocate_at_least(const size_type n) {
+        if (n > max_size())
+            TGP_TRY_THROW(std::bad_array_new_length());
+        if constexpr (alignof(T) > alignof(std::max_align_t)) {
+            return {static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T)))), n};
+        } else {
+            auto block = recycling_cache::allocate(n * sizeof(T));
+            return {static_cast<T*>(block.ptr), block.count / sizeof(T)};
+        }
+    }
+
+    void deallocate(T* p, const size_type n) noexcept {
+        if constexpr (alignof(T) > alignof(std::max_align_t))
+            ::operator delete(p, n * sizeof(T), std::align_val_t(alignof(T)));
+        else
+            recycling_cache::deallocate(p, n * sizeof(T));
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return static_cast<size_type>(PTRDIFF_MAX) / sizeof(T);
+    }
+    /* end of function members */
+
+}; // end of class recycling_allocator
+
+template<class T, class U>
+TGP_NODISCARD bool operator==(const recycling_allocator<T>&, const recycling_allocator<U>&) noexcept {
+    return true;
+}
+/* end of recycling_allocator */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_RECYCLING_ALLOCATOR_H
@@ -0,0 +1,365 @@
+#ifndef TSTL_INCLUDE_TGP_SMALL_VECTOR_H
+#define TSTL_INCLUDE_TGP_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include <tgp/config.h>
+#include <tgp/memory.h>
+#include <tgp/vector.h>
+
+NAMESPACE_TGP_BEGIN
+
+/* begin of small_buffer */
+// inline storage for N elements, handed out by small_buffer_allocator
+template<class T, std::size_t N>
+struct small_buffer {
+    alignas(T) unsigned char bytes_[N * sizeof(T)];
+    bool in_use_ = false;
+
+    TGP_NODISCARD T* data() noexcept {
+        return reinterpret_cast<T*>(bytes_);
+    }
+
+    TGP_NODISCARD const T* data() const noexcept {
+        return reinterpret_cast<const T*>(bytes_);
+    }
+};
+/* end of small_buffer */
+
+
+/* begin of small_buffer_allocator */
+/*
+ * serves requests of at most N elements from a small_buffer while it is free, and everything else from
+ * the upstream allocator. copies share the small_buffer, so allocators of two containers never compare equal.
+ */
+template<class T, std::size_t N, class Allocator>
+class small_buffer_allocator {
+    static_assert(std::is_pointer_v<typename std::allocator_traits<Allocator>::pointer>);
+
+    using upstream_traits = std::allocator_traits<Allocator>;
+
+public:
+    /* begin of public alias members */
+    using value_type                             = T;
+    using size_type                              = typename upstream_traits::size_type;
+    using difference_type                        = typename upstream_traits::difference_type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap            = std::false_type;
+    using is_always_equal                        = std::false_type;
+
+    // the small_buffer only holds T, other types come straight from upstream. rebinding to T itself keeps the
+    // buffer, as the allocator requirements ask
+    template<class U>
+    struct rebind {
+        using other = conditional_t<is_same_v<U, T>, small_buffer_allocator,
+                                    typename upstream_traits::template rebind_alloc<U>>;
+    };
+    /* end of public alias members */
+
+
+    /* begin of function members */
+    small_buffer_allocator(small_buffer<T, N>* buffer, const Allocator& upstream) noexcept
+        : buffer_(buffer), upstream_(upstream) {}
+
+    TGP_NODISCARD T* allocate(const size_type n) {
+        return allocate_at_least(n).ptr;
+    }
+
+    TGP_NODISCARD allocation_result<T*, size_type> allocate_at_least(const size_type n) {
+        if (!buffer_->in_use_ && n <= N) {
+            buffer_->in_use_ = true;
+            return {buffer_->data(), N};
+        }
+        return tgp::allocate_at_least(upstream_, n);
+    }
+
+    void deallocate(T* p, const size_type n) noexcept {
+        if (p == buffer_->data())
+            buffer_->in_use_ = false;
+        else
+            upstream_traits::deallocate(upstream_, p, n);
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return upstream_traits::max_size(upstream_);
+    }
+
+    TGP_NODISCARD const Allocator& upstream() const noexcept {
+        return upstream_;
+    }
+
+    TGP_NODISCARD Allocator& upstream() noexcept {
+        return upstream_;
+    }
+
+    TGP_NODISCARD friend bool operator==(const small_buffer_allocator& lhs, const small_buffer_allocator& rhs) noexcept {
+        return lhs.buffer_ == rhs.buffer_ && lhs.upstream_ == rhs.upstream_;
+    }
+    /* end of function members */
+
+private:
+    /* begin of private data members */
+    small_buffer<T, N>* buffer_;
+    Allocator upstream_;
+    /* end of private data members */
+
+}; // end of class small_buffer_allocator
+/* end of small_buffer_allocator */
+
+
+/*
+ * a vector keeping up to N elements inline. it is a vector over a small_buffer_allocator, so it spills to
+ * the heap through the usual split_buffer growth path, and returns inline on shrink_to_fit once the
+ * elements fit again.
+ * moving from a small_vector on the heap steals its buffer, moving from an inline one moves the elements.
+ */
+template<class T, std::size_t N, class Allocator = std::allocator<T>>
+class small_vector
+    : private small_buffer<T, N>,
+      private vector<T, small_buffer_allocator<T, N, Allocator>> {
+    static_assert(N > 0);
+    static_assert(is_same_v<T, typename Allocator::value_type>);
+
+    using buffer_type = small_buffer<T, N>;
+    using base        = vector<T, small_buffer_allocator<T, N, Allocator>>;
+
+    // take() moves the elements one by one unless the upstream allocators compare equal, and allocates
+    // for them if other is on the heap
+    static constexpr bool nothrow_take = std::allocator_traits<Allocator>::is_always_equal::value &&
+                                         std::is_nothrow_move_constructible_v<T> &&
+                                         std::is_nothrow_move_assignable_v<T>;
+
+public:
+    /* begin of public alias members */
+    using value_type                = T;
+    using allocator_type            = Allocator;
+    using size_type                 = typename base::size_type;
+    using difference_type           = typename base::difference_type;
+    using reference                 = typename base::reference;
+    using const_reference           = typename base::const_reference;
+    using pointer                   = typename base::pointer;
+    using const_pointer             = typename base::const_pointer;
+    using iterator                  = typename base::iterator;
+    using const_iterator            = typename base::const_iterator;
+    using reverse_iterator          = typename base::reverse_iterator;
+    using const_reverse_iterator    = typename base::const_reverse_iterator;
+
+    static constexpr size_type inline_capacity = N;
+    /* end of public alias members */
+
+
+    /* begin of constructor and destructor */
+    small_vector() noexcept(noexcept(allocator_type()))
+        : small_vector(allocator_type()) {}
+
+    explicit small_vector(const allocator_type& alloc) noexcept
+        : base(small_buffer_allocator<T, N, Allocator>(static_cast<buffer_type*>(this), alloc)) {
+        base::reserve(N);
+    }
+
+    explicit small_vector(const size_type count, const allocator_type& alloc = allocator_type())
+        : small_vector(alloc) {
+        base::resize(count);
+    }
+
+    small_vector(const size_type count, default_init_t, const allocator_type& alloc = allocator_type())
+        : small_vector(alloc) {
+        base::resize(count, default_init);
+    }
+
+    small_vector(const size_type count, const value_type& value, const allocator_type& alloc = allocator_type())
+        : small_vector(alloc) {
+        base::resize(count, value);
+    }
+
+    template<class InputIt, enable_if_t<has_input_iterator_category<InputIt>::value, int> = 0>
+    small_vector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+        : small_vector(alloc) {
+        base::assign(first, last);
+    }
+
+    small_vector(std::initializer_list<value_type> init, const allocator_type& alloc = allocator_type())
+        : small_vector(init.begin(), init.end(), alloc) {}
+
+    small_vector(const small_vector& other)
+        : small_vector(std::allocator_traits<allocator_type>::select_on_container_copy_construction(
+                           other.get_allocator())) {
+        base::assign(other.begin(), other.end());
+    }
+
+    small_vector(const small_vector& other, const allocator_type& alloc)
+        : small_vector(alloc) {
+        base::assign(other.begin(), other.end());
+    }
+
+    small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+        : small_vector(other.get_allocator()) {
+        take(other);
+    }
+
+    small_vector(small_vector&& other, const allocator_type& alloc)
+        : small_vector(alloc) {
+        take(other);
+    }
+
+    ~small_vector() = default;
+    /* end of constructor and destructor */
+
+
+    /* begin of element access */
+    using base::operator[];
+    using base::at;
+    using base::front;
+    using base::back;
+    using base::data;
+    /* end of element access */
+
+
+    /* begin of iterators */
+    using base::begin;
+    using base::cbegin;
+    using base::end;
+    using base::cend;
+    using base::rbegin;
+    using base::crbegin;
+    using base::rend;
+    using base::crend;
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    using base::capacity;
+    using base::max_size;
+    using base::size;
+    using base::empty;
+    using base::reserve;
+
+    // only moves the elements back inline, an inline small_vector is as small as it gets
+    void shrink_to_fit() {
+        if (!is_inline())
+            base::shrink_to_fit();
+    }
+
+    TGP_NODISCARD bool is_inline() const noexcept {
+        return base::data() == buffer_type::data();
+    }
+    /* end of capacity */
+
+
+    /* begin of modifiers */
+    using base::clear;
+    using base::erase;
+    using base::erase_unordered;
+    using base::erase_indices;
+    using base::insert;
+#if TGP_STD_VER >= 20
+    using base::insert_range;
+    using base::append_range;
+#endif
+    using base::emplace;
+    using base::emplace_back;
+    using base::push_back;
+    using base::pop_back;
+    using base::resize;
+
+    void swap(small_vector& other)
+    noexcept(nothrow_take) {
+        if (this == std::addressof(other))
+            return;
+        if (!is_inline() && !other.is_inline()) {
+            using std::swap;
+            swap(this->begin_, other.begin_);
+            swap(this->end_, other.end_);
+            swap(this->cap_, other.cap_);
+            if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_swap::value)
+                swap(this->alloc_.upstream(), other.alloc_.upstream());
+        } else {
+            small_vector tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+        }
+    }
+    /* end of modifiers */
+
+
+    /* begin of miscellaneous */
+    TGP_NODISCARD allocator_type get_allocator() const noexcept {
+        return base::get_allocator().upstream();
+    }
+
+    small_vector& operator=(const small_vector& other) {
+        if (this != std::addressof(other))
+            base::assign(other.begin(), other.end());
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other)
+    noexcept(nothrow_take) {
+        if (this != std::addressof(other))
+            take(other);
+        return *this;
+    }
+
+    small_vector& operator=(std::initializer_list<value_type> ilist) {
+        base::assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    using base::assign;
+#if TGP_STD_VER >= 20
+    using base::assign_range;
+#endif
+    /* end of miscellaneous */
+
+private:
+    /* begin of private function members */
+    // steals other's heap buffer if it has one, and moves its elements otherwise. other is left empty
+    void take(small_vector& other) {
+        if (!other.is_inline() && this->alloc_.upstream() == other.alloc_.upstream()) {
+            base::deallocate_vector();
+            this->begin_ = other.begin_;
+            this->end_   = other.end_;
+            this->cap_   = other.cap_;
+            other.begin_ = other.end_ = other.cap_ = nullptr;
+            other.base::reserve(N);
+        } else {
+            base::assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            other.clear();
+        }
+    }
+    /* end of private function members */
+
+}; // end of class small_vector
+
+template<class T, std::size_t N, class Alloc, class U>
+typename small_vector<T, N, Alloc>::size_type erase(small_vector<T, N, Alloc>& c, const U& value) {
+    const auto old_size = c.size();
+    c.erase(std::remove(c.begin(), c.end(), value), c.end());
+    return old_size - c.size();
+}
+
+template<class T, std::size_t N, class Alloc, class Pred>
+typename small_vector<T, N, Alloc>::size_type erase_if(small_vector<T, N, Alloc>& c, Pred pred) {
+    const auto old_size = c.size();
+    c.erase(std::remove_if(c.begin(), c.end(), pred), c.end());
+    return old_size - c.size();
+}
+
+NAMESPACE_TGP_END
+
+namespace std {
+
+template<class T, std::size_t N, class Alloc>
+void swap(tgp::small_vector<T, N, Alloc>& lhs, tgp::small_vector<T, N, Alloc>& rhs)
+TGP_NOEXCEPT_CONDITIONALLY_SINCE_CXX17(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+} // end of namespace std
+
+#endif // end of TSTL_INCLUDE_TGP_SMALL_VECTOR_H
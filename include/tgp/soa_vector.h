@@ -0,0 +1,605 @@
+#ifndef TSTL_INCLUDE_TGP_SOA_VECTOR_H
+#define TSTL_INCLUDE_TGP_SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <tgp/config.h>
+#include <tgp/compare.h>
+#include <tgp/exception.h>
+#include <tgp/growth_policy.h>
+#include <tgp/memory.h>
+#include <tgp/split_buffer.h>
+#include <tgp/type_traits.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a row of a soa_vector, a tuple of references into its columns. assigning to it, even to a temporary or a
+ * const one, assigns through to the columns and swapping two rows swaps their elements, which is what lets the
+ * mutating algorithms permute rows through an iterator whose operator* returns it by value.
+ */
+template<class... Ts>
+class soa_reference : public std::tuple<Ts&...> {
+    using base = std::tuple<Ts&...>;
+
+public:
+    using base::base;
+
+    soa_reference(const soa_reference&) = default;
+
+    // refers to the elements of a row of values
+    soa_reference(std::tuple<std::remove_const_t<Ts>...>& row) noexcept
+        : base(std::apply([](auto&... values) { return base(values...); }, row)) {}
+
+    const soa_reference& operator=(const soa_reference& other) const {
+        assign(other, std::index_sequence_for<Ts...>());
+        return *this;
+    }
+
+    // from a row, a moved row or a tuple of values
+    template<class... Us, enable_if_t<sizeof...(Us) == sizeof...(Ts), int> = 0>
+    const soa_reference& operator=(const std::tuple<Us...>& other) const {
+        assign(other, std::index_sequence_for<Ts...>());
+        return *this;
+    }
+
+    template<class... Us, enable_if_t<sizeof...(Us) == sizeof...(Ts), int> = 0>
+    const soa_reference& operator=(std::tuple<Us...>&& other) const {
+        assign(std::move(other), std::index_sequence_for<Ts...>());
+        return *this;
+    }
+
+    friend void swap(const soa_reference& lhs, const soa_reference& rhs) noexcept(
+        (std::is_nothrow_swappable_v<Ts> && ...)) {
+        lhs.swap_with(rhs, std::index_sequence_for<Ts...>());
+    }
+
+private:
+    template<class Tuple, std::size_t... I>
+    void assign(Tuple&& other, std::index_sequence<I...>) const {
+        ((std::get<I>(static_cast<const base&>(*this)) = std::get<I>(std::forward<Tuple>(other))), ...);
+    }
+
+    template<std::size_t... I>
+    void swap_with(const soa_reference& other, std::index_sequence<I...>) const {
+        using std::swap;
+        (swap(std::get<I>(static_cast<const base&>(*this)), std::get<I>(static_cast<const base&>(other))), ...);
+    }
+};
+
+/*
+ * a sequence of rows (Ts...) stored as one array per column, so that a scan over one field touches only that
+ * field's cache lines and can be vectorized. all columns share one size and one capacity and grow together.
+ * a row is a soa_reference, a tuple of references into the columns, and column<I>() is the whole column as a span.
+ *
+ * growing builds the new columns in split_buffers first and installs them only once all of them are built,
+ * so every operation that adds rows either succeeds or leaves the vector as it was. the columns whose
+ * elements may throw while relocating are copied during that first phase, the others are relocated after.
+ */
+template<class... Ts>
+class soa_vector {
+    static_assert(sizeof...(Ts) > 0);
+    static_assert((std::is_same_v<Ts, std::remove_cv_t<std::remove_reference_t<Ts>>> && ...));
+
+    template<bool Const>
+    class basic_iterator;
+
+public:
+    /* begin of public alias members */
+    using value_type      = std::tuple<Ts...>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = soa_reference<Ts...>;
+    using const_reference = soa_reference<const Ts...>;
+    using iterator        = basic_iterator<false>;
+    using const_iterator  = basic_iterator<true>;
+
+    template<std::size_t I>
+    using column_type = std::tuple_element_t<I, value_type>;
+
+    static constexpr std::size_t column_count = sizeof...(Ts);
+    /* end of public alias members */
+
+
+    /* begin of constructor and destructor */
+    soa_vector() noexcept = default;
+
+    explicit soa_vector(const size_type count) {
+        resize(count);
+    }
+
+    soa_vector(const size_type count, const value_type& row) {
+        resize(count, row);
+    }
+
+    soa_vector(std::initializer_list<value_type> init) {
+        reserve(init.size());
+        for (const value_type& row : init)
+            push_back(row);
+    }
+
+    soa_vector(const soa_vector& other) {
+        if (other.size_ > 0) {
+            auto copy = [&other](auto column, auto& alloc, auto* out) {
+                const auto* const first = std::get<decltype(column)::value>(other.columns_);
+                uninitialized_allocator_copy(alloc, first, first + other.size_, out);
+            };
+            append_rows(other.size_, copy);
+        }
+    }
+
+    soa_vector(soa_vector&& other) noexcept
+        : columns_(std::exchange(other.columns_, {})),
+          size_(std::exchange(other.size_, 0)),
+          cap_(std::exchange(other.cap_, 0)) {}
+
+    soa_vector& operator=(const soa_vector& other) {
+        if (this != std::addressof(other))
+            soa_vector(other).swap(*this);
+        return *this;
+    }
+
+    soa_vector& operator=(soa_vector&& other) noexcept {
+        soa_vector(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~soa_vector() {
+        deallocate_columns(std::index_sequence_for<Ts...>());
+    }
+    /* end of constructor and destructor */
+
+
+    /* begin of element access */
+    TGP_NODISCARD reference operator[](const size_type pos) noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size_);
+        return std::apply([pos](Ts*... columns) { return reference(columns[pos]...); }, columns_);
+    }
+
+    TGP_NODISCARD const_reference operator[](const size_type pos) const noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size_);
+        return std::apply([pos](Ts*... columns) { return const_reference(columns[pos]...); }, columns_);
+    }
+
+    TGP_NODISCARD reference at(const size_type pos) {
+        if (pos >= size_)
+            TGP_TRY_THROW(std::out_of_range("tgp::soa_vector::at out of range"));
+        return (*this)[pos];
+    }
+
+    TGP_NODISCARD const_reference at(const size_type pos) const {
+        if (pos >= size_)
+            TGP_TRY_THROW(std::out_of_range("tgp::soa_vector::at out of range"));
+        return (*this)[pos];
+    }
+
+    TGP_NODISCARD reference front() noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(size_ > 0);
+        return (*this)[0];
+    }
+
+    TGP_NODISCARD const_reference front() const noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(size_ > 0);
+        return (*this)[0];
+    }
+
+    TGP_NODISCARD reference back() noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(size_ > 0);
+        return (*this)[size_ - 1];
+    }
+
+    TGP_NODISCARD const_reference back() const noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(size_ > 0);
+        return (*this)[size_ - 1];
+    }
+
+    template<std::size_t I>
+    TGP_NODISCARD std::span<column_type<I>> column() noexcept {
+        return std::span<column_type<I>>(std::get<I>(columns_), size_);
+    }
+
+    template<std::size_t I>
+    TGP_NODISCARD std::span<const column_type<I>> column() const noexcept {
+        return std::span<const column_type<I>>(std::get<I>(columns_), size_);
+    }
+
+    template<std::size_t I>
+    TGP_NODISCARD column_type<I>* data() noexcept {
+        return std::get<I>(columns_);
+    }
+
+    template<std::size_t I>
+    TGP_NODISCARD const column_type<I>* data() const noexcept {
+        return std::get<I>(columns_);
+    }
+    /* end of element access */
+
+
+    /* begin of iterators */
+    TGP_NODISCARD iterator begin() noexcept {
+        return iterator(columns_);
+    }
+
+    TGP_NODISCARD const_iterator begin() const noexcept {
+        return const_iterator(columns_);
+    }
+
+    TGP_NODISCARD iterator end() noexcept {
+        return begin() + static_cast<difference_type>(size_);
+    }
+
+    TGP_NODISCARD const_iterator end() const noexcept {
+        return begin() + static_cast<difference_type>(size_);
+    }
+
+    TGP_NODISCARD const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    TGP_NODISCARD const_iterator cend() const noexcept {
+        return end();
+    }
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    TGP_NODISCARD bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    TGP_NODISCARD size_type size() const noexcept {
+        return size_;
+    }
+
+    TGP_NODISCARD size_type capacity() const noexcept {
+        return cap_;
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / std::max({sizeof(Ts)...});
+    }
+
+    void reserve(const size_type new_cap) {
+        if (new_cap > cap_) {
+            if (new_cap > max_size())
+                TGP_TRY_THROW(std::length_error("tgp::soa_vector::reserve demanding size exceeds max size"));
+            reallocate(new_cap, 0, no_rows);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (cap_ > size_) {
+            if (size_ == 0) {
+                deallocate_columns(std::index_sequence_for<Ts...>());
+            } else {
+                TGP_TRY {
+                    reallocate(size_, 0, no_rows);
+                } TGP_CATCH (...) {
+
+                }
+            }
+        }
+    }
+    /* end of capacity */
+
+
+    /* begin of modifiers */
+    void clear() noexcept {
+        destruct_at_end(0, std::index_sequence_for<Ts...>());
+    }
+
+    // one argument per column
+    template<class... Args>
+    reference emplace_back(Args&&... args) {
+        static_assert(sizeof...(Args) == column_count);
+        auto values = std::forward_as_tuple(std::forward<Args>(args)...);
+        auto construct = [&values](auto column, auto& alloc, auto* out) {
+            std::allocator_traits<std::remove_reference_t<decltype(alloc)>>::construct(
+                alloc, out, std::get<decltype(column)::value>(std::move(values)));
+        };
+        append_rows(1, construct);
+        return back();
+    }
+
+    void push_back(const value_type& row) {
+        std::apply([this](const Ts&... values) { emplace_back(values...); }, row);
+    }
+
+    void push_back(value_type&& row) {
+        std::apply([this](Ts&... values) { emplace_back(std::move(values)...); }, row);
+    }
+
+    void pop_back() noexcept {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(size_ > 0);
+        destruct_at_end(size_ - 1, std::index_sequence_for<Ts...>());
+    }
+
+    void resize(const size_type count) {
+        if (count <= size_) {
+            destruct_at_end(count, std::index_sequence_for<Ts...>());
+        } else {
+            const size_type n = count - size_;
+            auto construct = [n](auto, auto& alloc, auto* out) {
+                uninitialized_allocator_value_construct_n(alloc, out, n);
+            };
+            append_rows(n, construct);
+        }
+    }
+
+    void resize(const size_type count, const value_type& row) {
+        if (count <= size_) {
+            destruct_at_end(count, std::index_sequence_for<Ts...>());
+        } else {
+            const size_type n = count - size_;
+            auto construct = [n, &row](auto column, auto& alloc, auto* out) {
+                uninitialized_allocator_fill_n(alloc, out, n, std::get<decltype(column)::value>(row));
+            };
+            append_rows(n, construct);
+        }
+    }
+
+    void swap(soa_vector& other) noexcept {
+        std::swap(columns_, other.columns_);
+        std::swap(size_, other.size_);
+        std::swap(cap_, other.cap_);
+    }
+    /* end of modifiers */
+
+private:
+    /* begin of private data members and alias members */
+    template<std::size_t I>
+    using column_allocator = std::allocator<column_type<I>>;
+
+    // relocating the column may throw, its elements are copied while the old column is still intact
+    template<std::size_t I>
+    static constexpr bool copied_on_growth =
+        !is_trivially_allocator_relocatable_v<column_allocator<I>, column_type<I>> &&
+        !std::is_nothrow_move_constructible_v<column_type<I>>;
+
+    static constexpr auto no_rows = [](auto, auto&, auto*) noexcept {};
+
+    std::tuple<Ts*...> columns_{};
+    size_type size_ = 0;
+    size_type cap_  = 0;
+    /* end of private data members and alias members */
+
+
+    /* begin of private function members */
+    TGP_NODISCARD size_type recommend_cap(const size_type new_size) const {
+        const size_type ms = max_size();
+        if (new_size > ms)
+            TGP_TRY_THROW(std::length_error("tgp::soa_vector::recommend_cap demanding size exceeds max size"));
+        return double_growth::recommend(cap_, new_size, ms, (sizeof(Ts) + ...));
+    }
+
+    /*
+     * adds n rows, construct(column, alloc, out) constructs the n elements of a column at out.
+     * it is called with std::integral_constant<std::size_t, I> for column I
+     */
+    template<class Construct>
+    void append_rows(const size_type n, Construct& construct) {
+        if (n > cap_ - size_)
+            reallocate(recommend_cap(size_ + n), n, construct);
+        else
+            construct_rows<0>(n, construct);
+        size_ += n;
+    }
+
+    // constructs column I and the following ones in place, destroying column I again if a later one throws
+    template<std::size_t I, class Construct>
+    void construct_rows(const size_type n, Construct& construct) {
+        if constexpr (I < column_count) {
+            column_allocator<I> alloc;
+            column_type<I>* const out = std::get<I>(columns_) + size_;
+            construct(std::integral_constant<std::size_t, I>(), alloc, out);
+            TGP_TRY {
+                construct_rows<I + 1>(n, construct);
+            } TGP_CATCH (...) {
+                allocator_destroy(alloc, out, out + n);
+                TGP_THROW;
+            }
+        }
+    }
+
+    // moves the rows into columns of new_cap elements and constructs n more rows after them
+    template<class Construct>
+    void reallocate(const size_type new_cap, const size_type n, Construct& construct) {
+        reallocate_columns<0>(new_cap, n, construct);
+        cap_ = new_cap;
+    }
+
+    /*
+     * builds the new column I in a split_buffer and recurses into the next columns. once all of them are built
+     * nothing can throw anymore, the old elements are relocated or destroyed and the split_buffer takes the old
+     * column away. if a column fails, unwinding frees the split_buffers of the columns before it.
+     */
+    template<std::size_t I, class Construct>
+    void reallocate_columns(const size_type new_cap, const size_type n, Construct& construct) {
+        if constexpr (I < column_count) {
+            using T = column_type<I>;
+            column_allocator<I> alloc;
+            split_buffer<T, column_allocator<I>&> sb(new_cap, size_, alloc);
+            construct(std::integral_constant<std::size_t, I>(), alloc, tgp::to_address(sb.end_));
+            sb.end_ += n;
+            T* const old = std::get<I>(columns_);
+            if constexpr (copied_on_growth<I>) {
+                uninitialized_allocator_copy(alloc, old, old + size_, tgp::to_address(sb.first_));
+                sb.begin_ = sb.first_;
+            }
+
+            reallocate_columns<I + 1>(new_cap, n, construct);
+
+            if constexpr (copied_on_growth<I>)
+                allocator_destroy(alloc, old, old + size_);
+            else
+                uninitialized_allocator_relocate(alloc, old, old + size_, tgp::to_address(sb.first_));
+            std::get<I>(columns_) = tgp::to_address(sb.first_);
+            sb.first_ = sb.begin_ = sb.end_ = old;
+            sb.cap_   = old + cap_;
+        }
+    }
+
+    template<std::size_t... I>
+    void destruct_at_end(const size_type new_size, std::index_sequence<I...>) noexcept {
+        (destruct_column_at_end<I>(new_size), ...);
+        size_ = new_size;
+    }
+
+    template<std::size_t I>
+    void destruct_column_at_end(const size_type new_size) noexcept {
+        column_allocator<I> alloc;
+        allocator_destroy(alloc, std::get<I>(columns_) + new_size, std::get<I>(columns_) + size_);
+    }
+
+    template<std::size_t... I>
+    void deallocate_columns(std::index_sequence<I...>) noexcept {
+        if (cap_ > 0) {
+            (deallocate_column<I>(), ...);
+            columns_ = {};
+            size_ = cap_ = 0;
+        }
+    }
+
+    template<std::size_t I>
+    void deallocate_column() noexcept {
+        column_allocator<I> alloc;
+        column_type<I>* const first = std::get<I>(columns_);
+        allocator_destroy(alloc, first, first + size_);
+        std::allocator_traits<column_allocator<I>>::deallocate(alloc, first, cap_);
+    }
+    /* end of private function members */
+
+}; // end of class soa_vector
+
+
+/* begin of soa_vector iterator */
+// a pointer into each column, moving in lockstep
+template<class... Ts>
+template<bool Const>
+class soa_vector<Ts...>::basic_iterator {
+    using pointers = std::tuple<conditional_t<Const, const Ts*, Ts*>...>;
+
+public:
+    // operator* returns a proxy, which only c++20 iterators may do
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept  = std::random_access_iterator_tag;
+    using value_type        = std::tuple<Ts...>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = conditional_t<Const, soa_reference<const Ts...>, soa_reference<Ts...>>;
+    using rvalue_reference  = conditional_t<Const, std::tuple<const Ts&&...>, std::tuple<Ts&&...>>;
+
+    basic_iterator() noexcept = default;
+
+    explicit basic_iterator(const std::tuple<Ts*...>& columns) noexcept : ptrs_(columns) {}
+
+    template<bool C = Const, enable_if_t<C, int> = 0>
+    basic_iterator(const basic_iterator<false>& other) noexcept : ptrs_(other.ptrs_) {}
+
+    TGP_NODISCARD reference operator*() const noexcept {
+        return std::apply([](auto*... p) { return reference(*p...); }, ptrs_);
+    }
+
+    TGP_NODISCARD reference operator[](const difference_type n) const noexcept {
+        return *(*this + n);
+    }
+
+    basic_iterator& operator++() noexcept { return *this += 1; }
+    basic_iterator& operator--() noexcept { return *this += -1; }
+
+    basic_iterator operator++(int) noexcept { basic_iterator tmp = *this; ++*this; return tmp; }
+    basic_iterator operator--(int) noexcept { basic_iterator tmp = *this; --*this; return tmp; }
+
+    basic_iterator& operator+=(const difference_type n) noexcept {
+        std::apply([n](auto*&... p) { ((p += n), ...); }, ptrs_);
+        return *this;
+    }
+
+    basic_iterator& operator-=(const difference_type n) noexcept { return *this += -n; }
+
+    TGP_NODISCARD friend basic_iterator operator+(basic_iterator it, const difference_type n) noexcept {
+        return it += n;
+    }
+
+    TGP_NODISCARD friend basic_iterator operator+(const difference_type n, basic_iterator it) noexcept {
+        return it += n;
+    }
+
+    TGP_NODISCARD friend basic_iterator operator-(basic_iterator it, const difference_type n) noexcept {
+        return it -= n;
+    }
+
+    // every column moves alike, the first one stands for all
+    TGP_NODISCARD friend difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return std::get<0>(lhs.ptrs_) - std::get<0>(rhs.ptrs_);
+    }
+
+    TGP_NODISCARD friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return std::get<0>(lhs.ptrs_) == std::get<0>(rhs.ptrs_);
+    }
+
+    TGP_NODISCARD friend auto operator<=>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return std::get<0>(lhs.ptrs_) <=> std::get<0>(rhs.ptrs_);
+    }
+
+    TGP_NODISCARD friend rvalue_reference iter_move(const basic_iterator& it) noexcept {
+        return std::apply([](auto*... p) { return rvalue_reference(std::move(*p)...); }, it.ptrs_);
+    }
+
+    // swaps the rows column by column
+    template<bool C = Const, enable_if_t<!C, int> = 0>
+    friend void iter_swap(const basic_iterator& lhs, const basic_iterator& rhs) noexcept(
+        (std::is_nothrow_swappable_v<Ts> && ...)) {
+        // finds the rows' swap instead of the container's
+        using std::swap;
+        swap(*lhs, *rhs);
+    }
+
+private:
+    friend class basic_iterator<!Const>;
+
+    pointers ptrs_{};
+};
+/* end of soa_vector iterator */
+
+NAMESPACE_TGP_END
+
+namespace std {
+
+template<class... Ts>
+void swap(tgp::soa_vector<Ts...>& lhs, tgp::soa_vector<Ts...>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// a row is a tuple to structured bindings
+template<class... Ts>
+struct tuple_size<tgp::soa_reference<Ts...>> : integral_constant<size_t, sizeof...(Ts)> {};
+
+template<size_t I, class... Ts>
+struct tuple_element<I, tgp::soa_reference<Ts...>> : tuple_element<I, tuple<Ts&...>> {};
+
+// a row and a row of values meet in the row, so that the iterators are readable
+template<class... Ts, class... Us, template<class> class TQual, template<class> class UQual>
+    requires (is_same_v<remove_const_t<Ts>, Us> && ...)
+struct basic_common_reference<tgp::soa_reference<Ts...>, tuple<Us...>, TQual, UQual> {
+    using type = tgp::soa_reference<Ts...>;
+};
+
+template<class... Ts, class... Us, template<class> class TQual, template<class> class UQual>
+    requires (is_same_v<remove_const_t<Ts>, Us> && ...)
+struct basic_common_reference<tuple<Us...>, tgp::soa_reference<Ts...>, TQual, UQual> {
+    using type = tgp::soa_reference<Ts...>;
+};
+
+} // end of namespace std
+
+#endif // end of TSTL_INCLUDE_TGP_SOA_VECTOR_H
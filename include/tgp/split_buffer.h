@@ -1,10 +1,13 @@
 #ifndef TSTL_INCLUDE_TGP_SPLIT_BUFFER_H
 #define TSTL_INCLUDE_TGP_SPLIT_BUFFER_H
 
+#include <algorithm>
 #include <memory>
 #include <type_traits>
 
 #include <tgp/config.h>
+#include <tgp/memory.h>
+#include <tgp/type_traits.h>
 
 NAMESPACE_TGP_BEGIN
 
@@ -13,12 +16,13 @@ NAMESPACE_TGP_BEGIN
  * it's used temporarily when:
  *  1. realloc when running out of capacity of vector or shrinking capacity of vector
  *  2. insert elements into vector
+ *  3. as the block map of deque, which grows at both ends
  *  ...
+ * temporaries refer to the allocator of their container, Allocator is then an lvalue reference;
+ * a split_buffer living as long as its container holds its allocator by value.
  */
 template<class T, class Allocator>
 struct split_buffer {
-    static_assert(std::is_lvalue_reference_v<Allocator>);
-
 
     /* begin of alias members */
     using value_type                = T;
@@ -38,7 +42,7 @@ struct split_buffer {
     pointer first_ = nullptr;
     pointer begin_ = nullptr;
     pointer end_   = nullptr;
-    _LIBCPP_COMPRESSED_PAIR(pointer, cap_ = nullptr, allocator_type, alloc_);
+    TGP_COMPRESSED_PAIR(pointer, cap_ = nullptr, allocator_type, alloc_);
     /* end of data members */
 
 
@@ -46,19 +50,23 @@ struct split_buffer {
     split_buffer(const split_buffer&)            = delete;
     split_buffer& operator=(const split_buffer&) = delete;
 
+    TGP_CONSTEXPR_SINCE_CXX20 explicit split_buffer(Allocator alloc) noexcept
+        : alloc_(alloc) {}
+
     TGP_CONSTEXPR_SINCE_CXX20 split_buffer(size_type cap, size_type pre_reserve, Allocator alloc)
         : alloc_(alloc) {
 
-        first_  = alloc_traits::allocate(alloc_, cap);
+        auto allocation = tgp::allocate_at_least(alloc_, cap);
+        first_  = allocation.ptr;
         begin_  = first_ + pre_reserve;
         end_    = begin_;
-        cap_    = first_ + cap;
+        cap_    = first_ + allocation.count;
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 ~split_buffer() {
-        if (begin_) {
+        if (first_) {
             clear();
-            alloc_traits::deallocate(alloc_, begin_, capacity());
+            alloc_traits::deallocate(alloc_, first_, capacity());
         }
     }
 
@@ -66,45 +74,128 @@ struct split_buffer {
         return static_cast<size_type>(cap_ - first_);
     }
 
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type size() const noexcept {
+        return static_cast<size_type>(end_ - begin_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 bool empty() const noexcept {
+        return begin_ == end_;
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type front_spare() const noexcept {
+        return static_cast<size_type>(begin_ - first_);
+    }
+
+    TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 size_type back_spare() const noexcept {
+        return static_cast<size_type>(cap_ - end_);
+    }
+
     TGP_CONSTEXPR_SINCE_CXX20 void clear() noexcept {
         for (; begin_ != end_; ++begin_)
-            alloc_traits::destroy(alloc_, std::__to_address(begin_));
+            alloc_traits::destroy(alloc_, tgp::to_address(begin_));
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(const size_type n) {
-        for (size_type i = 0; i < n; ++i) {
-            alloc_traits::construct(alloc_, std::__to_address(end_));
-            ++end_;
-        }
+        uninitialized_allocator_value_construct_n(alloc_, tgp::to_address(end_), n);
+        end_ += n;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(const size_type n, default_init_t) {
+        uninitialized_allocator_default_construct_n(alloc_, tgp::to_address(end_), n);
+        end_ += n;
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(const size_type n, const T& value) {
-        for (size_type i = 0; i < n; ++i) {
-            alloc_traits::construct(alloc_, std::__to_address(end_), value);
-            ++end_;
-        }
+        uninitialized_allocator_fill_n(alloc_, tgp::to_address(end_), n, value);
+        end_ += n;
     }
 
     template<class InputIt>
     TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(InputIt first, InputIt last) {
-        for (; first != last; ++first) {
-            ::new (static_cast<void*>(std::__to_address(end_))) value_type(*first);
-            ++end_;
-        }
+        value_type* e = tgp::to_address(end_);
+        end_ += (uninitialized_allocator_copy(alloc_, first, last, e) - e);
     }
 
     template<class... Args>
     TGP_CONSTEXPR_SINCE_CXX20 void emplace_back(Args&&... args) {
-        alloc_traits::construct(alloc_, std::__to_address(end_), std::forward<Args>(args)...);
+        alloc_traits::construct(alloc_, tgp::to_address(end_), std::forward<Args>(args)...);
         ++end_;
     }
 
     template<class... Args>
     TGP_CONSTEXPR_SINCE_CXX20 void emplace_front(Args&&... args) {
-        alloc_traits::construct(alloc_, std::__to_address(begin_ - 1), std::forward<Args>(args)...);
+        alloc_traits::construct(alloc_, tgp::to_address(begin_ - 1), std::forward<Args>(args)...);
         --begin_;
     }
 
+    // unlike emplace_back and emplace_front, these make room first if the end they grow at is full
+    TGP_CONSTEXPR_SINCE_CXX20 void push_back(const T& value) {
+        if (end_ == cap_)
+            make_room_at_back();
+        emplace_back(value);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void push_front(const T& value) {
+        if (begin_ == first_)
+            make_room_at_front();
+        emplace_front(value);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void pop_back() noexcept {
+        alloc_traits::destroy(alloc_, tgp::to_address(--end_));
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void pop_front() noexcept {
+        alloc_traits::destroy(alloc_, tgp::to_address(begin_++));
+    }
+
+    /*
+     * slides the elements half way into the spare room at the front if there is some, and otherwise moves them
+     * into a buffer twice as large, of whose free room a quarter is left at the front.
+     * sliding needs trivially relocatable elements, the others always take a new buffer.
+     */
+    TGP_CONSTEXPR_SINCE_CXX20 void make_room_at_back() {
+        if constexpr (is_trivially_allocator_relocatable_v<allocator_type, T>) {
+            if (begin_ != first_) {
+                const difference_type d = (begin_ - first_ + 1) / 2;
+                allocator_trivially_relocate(alloc_, tgp::to_address(begin_), tgp::to_address(end_),
+                                             tgp::to_address(begin_ - d));
+                begin_ -= d;
+                end_   -= d;
+                return;
+            }
+        }
+        const size_type new_cap = std::max<size_type>(2 * capacity(), 1);
+        relocate_into(new_cap, (new_cap - size()) / 4);
+    }
+
+    // the mirror image of make_room_at_back
+    TGP_CONSTEXPR_SINCE_CXX20 void make_room_at_front() {
+        if constexpr (is_trivially_allocator_relocatable_v<allocator_type, T>) {
+            if (end_ != cap_) {
+                const difference_type d = (cap_ - end_ + 1) / 2;
+                allocator_trivially_relocate(alloc_, tgp::to_address(begin_), tgp::to_address(end_),
+                                             tgp::to_address(begin_ + d));
+                begin_ += d;
+                end_   += d;
+                return;
+            }
+        }
+        const size_type new_cap = std::max<size_type>(2 * capacity(), 1);
+        relocate_into(new_cap, new_cap - size() - (new_cap - size()) / 4);
+    }
+
+    // swaps the buffers, and the allocators if they are held by value
+    TGP_CONSTEXPR_SINCE_CXX20 void swap(split_buffer& other) noexcept {
+        using std::swap;
+        swap(first_, other.first_);
+        swap(begin_, other.begin_);
+        swap(end_, other.end_);
+        swap(cap_, other.cap_);
+        if constexpr (!std::is_reference_v<Allocator>)
+            swap(alloc_, other.alloc_);
+    }
+
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 bool invariants() const {
         if (first_ == nullptr) {
             if (begin_ != nullptr || end_ != nullptr || cap_ != nullptr)
@@ -121,6 +212,23 @@ struct split_buffer {
     }
     /* end of function members */
 
+private:
+    /* begin of private function members */
+    // moves the elements into a new buffer of new_cap elements, pre_reserve of them in front of the elements
+    TGP_CONSTEXPR_SINCE_CXX20 void relocate_into(const size_type new_cap, const size_type pre_reserve) {
+        split_buffer<T, allocator_type&> sb(new_cap, pre_reserve, alloc_);
+        uninitialized_allocator_relocate(alloc_, tgp::to_address(begin_), tgp::to_address(end_),
+                                         tgp::to_address(sb.begin_));
+        sb.end_ = sb.begin_ + size();
+        end_ = begin_;
+        using std::swap;
+        swap(first_, sb.first_);
+        swap(begin_, sb.begin_);
+        swap(end_, sb.end_);
+        swap(cap_, sb.cap_);
+    }
+    /* end of private function members */
+
 }; // end of struct split_buffer
 
 NAMESPACE_TGP_END
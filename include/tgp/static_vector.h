@@ -0,0 +1,768 @@
+#ifndef TSTL_INCLUDE_TGP_STATIC_VECTOR_H
+#define TSTL_INCLUDE_TGP_STATIC_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include <tgp/config.h>
+#include <tgp/exception.h>
+#include <tgp/memory.h>
+#include <tgp/type_traits.h>
+#include <tgp/compare.h>
+
+NAMESPACE_TGP_BEGIN
+
+/*
+ * a vector whose N elements live inside the object, in the spirit of c++26 inplace_vector. it never allocates,
+ * growing past N throws std::bad_alloc, and the try_ modifiers report it by returning null instead.
+ * the copy and move operations and the destructor are trivial when T's are, so a static_vector of trivially
+ * copyable elements is itself trivially copyable and may be memcpy'd as a whole.
+ */
+template<class T, std::size_t N>
+class static_vector {
+    static_assert(N > 0);
+
+public:
+    /* begin of public alias members */
+    using value_type                = T;
+    using size_type                 = size_t;
+    using difference_type           = ptrdiff_t;
+    using reference                 = value_type&;
+    using const_reference           = const value_type&;
+    using pointer                   = value_type*;
+    using const_pointer             = const value_type*;
+    using iterator                  = pointer;
+    using const_iterator            = const_pointer;
+    using reverse_iterator          = std::reverse_iterator<iterator>;
+    using const_reverse_iterator    = std::reverse_iterator<const_iterator>;
+    /* end of public alias members */
+
+
+    /* begin of constructor and destructor */
+    constexpr static_vector() noexcept {}
+
+    constexpr explicit static_vector(const size_type count) {
+        check_room(count);
+        construct_at_end(count);
+    }
+
+    constexpr static_vector(const size_type count, default_init_t) {
+        check_room(count);
+        construct_at_end(count, default_init);
+    }
+
+    constexpr static_vector(const size_type count, const value_type& value) {
+        check_room(count);
+        construct_at_end(count, value);
+    }
+
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    constexpr static_vector(InputIt first, InputIt last) {
+        TGP_TRY {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        } TGP_CATCH (...) {
+            clear();
+            TGP_THROW;
+        }
+    }
+
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
+    constexpr static_vector(InputIt first, InputIt last) {
+        check_room(static_cast<size_type>(std::distance(first, last)));
+        construct_at_end(first, last);
+    }
+
+#if TGP_STD_VER >= 20
+    template<container_compatible_range<T> R>
+    constexpr static_vector(from_range_t, R&& rg) {
+        append_range(std::forward<R>(rg));
+    }
+#endif
+
+    constexpr static_vector(std::initializer_list<value_type> init)
+        : static_vector(init.begin(), init.end()) {}
+
+    constexpr static_vector(const static_vector& other) requires std::is_trivially_copyable_v<value_type> = default;
+
+    constexpr static_vector(const static_vector& other) {
+        construct_at_end(other.begin(), other.end());
+    }
+
+    constexpr static_vector(static_vector&& other) requires std::is_trivially_copyable_v<value_type> = default;
+
+    constexpr static_vector(static_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>) {
+        construct_at_end(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    }
+
+    constexpr ~static_vector() requires std::is_trivially_destructible_v<value_type> = default;
+
+    constexpr ~static_vector() {
+        clear();
+    }
+    /* end of constructor and destructor */
+
+
+    /* begin of element access */
+    TGP_NODISCARD constexpr reference operator[] (const size_type pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
+        return data()[pos];
+    }
+
+    TGP_NODISCARD constexpr const_reference operator[] (const size_type pos) const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
+        return data()[pos];
+    }
+
+    TGP_NODISCARD constexpr reference at(const size_type pos) {
+        if (pos >= size())
+            TGP_TRY_THROW(std::out_of_range("tgp::static_vector::at element access out of range"));
+        return data()[pos];
+    }
+
+    TGP_NODISCARD constexpr const_reference at(const size_type pos) const {
+        if (pos >= size())
+            TGP_TRY_THROW(std::out_of_range("tgp::static_vector::at element access out of range"));
+        return data()[pos];
+    }
+
+    TGP_NODISCARD constexpr reference front() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return data()[0];
+    }
+
+    TGP_NODISCARD constexpr const_reference front() const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return data()[0];
+    }
+
+    TGP_NODISCARD constexpr reference back() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return data()[size_ - 1];
+    }
+
+    TGP_NODISCARD constexpr const_reference back() const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        return data()[size_ - 1];
+    }
+
+    TGP_NODISCARD constexpr value_type* data() noexcept {
+        return elems_;
+    }
+
+    TGP_NODISCARD constexpr const value_type* data() const noexcept {
+        return elems_;
+    }
+    /* end of element access */
+
+
+    /* begin of iterators */
+    TGP_NODISCARD constexpr iterator begin() noexcept {
+        return data();
+    }
+
+    TGP_NODISCARD constexpr const_iterator begin() const noexcept {
+        return data();
+    }
+
+    TGP_NODISCARD constexpr const_iterator cbegin() const noexcept {
+        return begin();
+    }
+
+    TGP_NODISCARD constexpr iterator end() noexcept {
+        return data() + size_;
+    }
+
+    TGP_NODISCARD constexpr const_iterator end() const noexcept {
+        return data() + size_;
+    }
+
+    TGP_NODISCARD constexpr const_iterator cend() const noexcept {
+        return end();
+    }
+
+    TGP_NODISCARD constexpr reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    TGP_NODISCARD constexpr const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    TGP_NODISCARD constexpr const_reverse_iterator crbegin() const noexcept {
+        return rbegin();
+    }
+
+    TGP_NODISCARD constexpr reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD constexpr const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    TGP_NODISCARD constexpr const_reverse_iterator crend() const noexcept {
+        return rend();
+    }
+    /* end of iterators */
+
+
+    /* begin of capacity */
+    TGP_NODISCARD static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    TGP_NODISCARD static constexpr size_type max_size() noexcept {
+        return N;
+    }
+
+    TGP_NODISCARD constexpr size_type size() const noexcept {
+        return size_;
+    }
+
+    TGP_NODISCARD constexpr bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    // only checks that new_cap elements fit, the storage is always there
+    static constexpr void reserve(const size_type new_cap) {
+        if (new_cap > N)
+            TGP_TRY_THROW(std::bad_alloc());
+    }
+
+    static constexpr void shrink_to_fit() noexcept {}
+    /* end of capacity */
+
+
+    /* begin of modifiers */
+    constexpr void clear() noexcept {
+        destruct_at_end(data());
+    }
+
+    constexpr iterator erase(const_iterator pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos != end());
+        return erase(pos, pos + 1);
+    }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        TGP_ASSERT_VALID_INPUT_RANGE(first <= last);
+        pointer p = data() + (first - begin());
+        if (first != last) {
+            if constexpr (trivially_relocatable) {
+                pointer q = p + (last - first);
+                alloc_type alloc;
+                allocator_destroy(alloc, p, q);
+                allocator_trivially_relocate(alloc, q, end(), p);
+                size_ -= static_cast<size_type>(q - p);
+            } else {
+                destruct_at_end(std::move(p + (last - first), end(), p));
+            }
+        }
+        return p;
+    }
+
+    // moves the last element into the hole instead of shifting the tail, so the order is not kept
+    constexpr iterator erase_unordered(const_iterator pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos != end());
+        pointer p = data() + (pos - begin());
+        pointer last = end() - 1;
+        if constexpr (trivially_relocatable) {
+            alloc_type alloc;
+            allocator_destroy(alloc, p, p + 1);
+            if (p != last)
+                allocator_trivially_relocate(alloc, last, last + 1, p);
+            --size_;
+        } else {
+            if (p != last)
+                *p = std::move(*last);
+            destruct_at_end(last);
+        }
+        return p;
+    }
+
+    // erases the elements at the given strictly increasing indices, returns how many were erased
+    template<class IndexRange>
+    constexpr size_type erase_indices(const IndexRange& indices) {
+        auto it = std::begin(indices);
+        const auto last = std::end(indices);
+        if (it == last)
+            return 0;
+        const size_type old_size = size();
+        pointer out = data() + static_cast<size_type>(*it);
+        while (it != last) {
+            const auto index = static_cast<size_type>(*it);
+            const size_type next = ++it == last ? old_size : static_cast<size_type>(*it);
+            TGP_PRECONDITION(index < next && next <= old_size);
+            out = std::move(data() + index + 1, data() + next, out);
+        }
+        destruct_at_end(out);
+        return old_size - size();
+    }
+
+    constexpr iterator insert(const_iterator pos, const value_type& value) {
+        return emplace(pos, value);
+    }
+
+    constexpr iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    constexpr iterator insert(const_iterator pos, const size_type count, const value_type& value) {
+        pointer p = data() + (pos - begin());
+        if (count > 0) {
+            check_room(count);
+            if (is_internal_element_ref(value)) {
+                const value_type copy(value);
+                return insert(pos, count, copy);
+            }
+            if (p == end()) {
+                construct_at_end(count, value);
+            } else if constexpr (trivially_relocatable) {
+                move_range(p, end(), p + count);
+                TGP_TRY {
+                    alloc_type alloc;
+                    uninitialized_allocator_fill_n(alloc, p, count, value);
+                } TGP_CATCH (...) {
+                    close_gap(p, count);
+                    TGP_THROW;
+                }
+            } else {
+                const auto n = static_cast<size_type>(end() - p);
+                if (count > n) {
+                    construct_at_end(count - n, value);
+                    move_range(p, p + n, end());
+                } else {
+                    move_range(p, end(), p + count);
+                }
+                std::fill_n(p, std::min(count, n), value);
+            }
+        }
+        return p;
+    }
+
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        return insert_single_pass(pos, std::move(first), std::move(last));
+    }
+
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
+    constexpr iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        return insert_with_size(pos, first, last, static_cast<size_type>(std::distance(first, last)));
+    }
+
+    constexpr iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+#if TGP_STD_VER >= 20
+    // the range must not refer to elements of this static_vector
+    template<container_compatible_range<T> R>
+    constexpr iterator insert_range(const_iterator pos, R&& rg) {
+        if constexpr (std::ranges::forward_range<R>) {
+            const auto count = static_cast<size_type>(std::ranges::distance(rg));
+            const auto first = std::ranges::begin(rg);
+            return insert_with_size(pos, first, std::ranges::next(first, count), count);
+        } else {
+            return insert_single_pass(pos, std::ranges::begin(rg), std::ranges::end(rg));
+        }
+    }
+
+    // checks the room once for a sized range, so a range that does not fit leaves the elements as they are
+    template<container_compatible_range<T> R>
+    constexpr void append_range(R&& rg) {
+        if constexpr (std::ranges::forward_range<R>) {
+            const auto count = static_cast<size_type>(std::ranges::distance(rg));
+            check_room(count);
+            const auto first = std::ranges::begin(rg);
+            construct_at_end(first, std::ranges::next(first, count));
+        } else {
+            if constexpr (std::ranges::sized_range<R>)
+                check_room(static_cast<size_type>(std::ranges::size(rg)));
+            for (auto it = std::ranges::begin(rg); it != std::ranges::end(rg); ++it)
+                emplace_back(*it);
+        }
+    }
+#endif
+
+    template<class... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        pointer p = data() + (pos - begin());
+        check_room(1);
+        if (p == end()) {
+            construct_one_at_end(std::forward<Args>(args)...);
+        } else {
+            // args may refer to an element of this static_vector, so build the value before shifting
+            alloc_type alloc;
+            temp_value<value_type, alloc_type> tmp(alloc, std::forward<Args>(args)...);
+            move_range(p, end(), p + 1);
+            if constexpr (trivially_relocatable)
+                tmp.relocate_to(p);
+            else
+                *p = std::move(tmp.get());
+        }
+        return p;
+    }
+
+    template<class... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        check_room(1);
+        return construct_one_at_end(std::forward<Args>(args)...);
+    }
+
+    constexpr void push_back(const value_type& value) {
+        emplace_back(value);
+    }
+
+    constexpr void push_back(value_type&& value) {
+        emplace_back(std::move(value));
+    }
+
+    // returns the new element, or null without constructing anything if the static_vector is full
+    template<class... Args>
+    constexpr pointer try_emplace_back(Args&&... args) {
+        if (size_ == N)
+            return nullptr;
+        return std::addressof(construct_one_at_end(std::forward<Args>(args)...));
+    }
+
+    constexpr pointer try_push_back(const value_type& value) {
+        return try_emplace_back(value);
+    }
+
+    constexpr pointer try_push_back(value_type&& value) {
+        return try_emplace_back(std::move(value));
+    }
+
+    constexpr void pop_back() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
+        destruct_at_end(end() - 1);
+    }
+
+    constexpr void resize(const size_type count) {
+        if (count <= size_) {
+            destruct_at_end(data() + count);
+        } else {
+            check_room(count - size_);
+            construct_at_end(count - size_);
+        }
+    }
+
+    // leaves new trivially default constructible elements uninitialized, for buffers about to be overwritten
+    constexpr void resize(const size_type count, default_init_t) {
+        if (count <= size_) {
+            destruct_at_end(data() + count);
+        } else {
+            check_room(count - size_);
+            construct_at_end(count - size_, default_init);
+        }
+    }
+
+    constexpr void resize(const size_type count, const value_type& value) {
+        if (count <= size_) {
+            destruct_at_end(data() + count);
+        } else {
+            check_room(count - size_);
+            construct_at_end(count - size_, value);
+        }
+    }
+
+    // like vector::resize_and_overwrite, op(value_type* data, size_type count) returns how many elements to keep
+    template<class Operation>
+    constexpr void resize_and_overwrite(const size_type count, Operation op) {
+        static_assert(overwritable, "tgp::static_vector::resize_and_overwrite requires implicit-lifetime, "
+                                    "trivially destructible elements");
+        check_room(count > size_ ? count - size_ : 0);
+        const auto n = static_cast<size_type>(std::move(op)(data(), count));
+        TGP_PRECONDITION(n <= count);
+        size_ = n;
+    }
+
+    // like vector::append_n, op(value_type* out, size_type max_n) returns how many elements it appended
+    template<class Operation>
+    constexpr void append_n(const size_type max_n, Operation op) {
+        static_assert(overwritable, "tgp::static_vector::append_n requires implicit-lifetime, "
+                                    "trivially destructible elements");
+        check_room(max_n);
+        const auto n = static_cast<size_type>(std::move(op)(end(), max_n));
+        TGP_PRECONDITION(n <= max_n);
+        size_ += n;
+    }
+
+    // swaps the elements one by one, the static_vectors keep their storage
+    constexpr void swap(static_vector& other)
+    noexcept(std::is_nothrow_move_constructible_v<value_type> && std::is_nothrow_swappable_v<value_type>) {
+        static_vector& shorter = size_ < other.size_ ? *this : other;
+        static_vector& longer  = size_ < other.size_ ? other : *this;
+        std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+        const size_type n = shorter.size_;
+        shorter.construct_at_end(std::make_move_iterator(longer.begin() + n), std::make_move_iterator(longer.end()));
+        longer.destruct_at_end(longer.begin() + n);
+    }
+    /* end of modifiers */
+
+
+    /* begin of miscellaneous */
+    constexpr static_vector& operator=(const static_vector& other)
+        requires std::is_trivially_copyable_v<value_type> = default;
+
+    constexpr static_vector& operator=(const static_vector& other) {
+        if (this != std::addressof(other))
+            assign_with_size(other.begin(), other.end(), other.size());
+        return *this;
+    }
+
+    constexpr static_vector& operator=(static_vector&& other)
+        requires std::is_trivially_copyable_v<value_type> = default;
+
+    constexpr static_vector& operator=(static_vector&& other)
+    noexcept(std::is_nothrow_move_constructible_v<value_type> && std::is_nothrow_move_assignable_v<value_type>) {
+        if (this != std::addressof(other))
+            assign_with_size(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), other.size());
+        return *this;
+    }
+
+    constexpr static_vector& operator=(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    constexpr void assign(const size_type count, const value_type& value) {
+        check_room(count > size_ ? count - size_ : 0);
+        if (count > size_) {
+            std::fill_n(data(), size_, value);
+            construct_at_end(count - size_, value);
+        } else {
+            std::fill_n(data(), count, value);
+            destruct_at_end(data() + count);
+        }
+    }
+
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    constexpr void assign(InputIt first, InputIt last) {
+        assign_single_pass(std::move(first), std::move(last));
+    }
+
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
+    constexpr void assign(InputIt first, InputIt last) {
+        assign_with_size(first, last, static_cast<size_type>(std::distance(first, last)));
+    }
+
+    constexpr void assign(std::initializer_list<value_type> ilist) {
+        assign(ilist.begin(), ilist.end());
+    }
+
+#if TGP_STD_VER >= 20
+    template<container_compatible_range<T> R>
+    constexpr void assign_range(R&& rg) {
+        if constexpr (std::ranges::forward_range<R>) {
+            const auto count = static_cast<size_type>(std::ranges::distance(rg));
+            const auto first = std::ranges::begin(rg);
+            assign_with_size(first, std::ranges::next(first, count), count);
+        } else {
+            assign_single_pass(std::ranges::begin(rg), std::ranges::end(rg));
+        }
+    }
+#endif
+    /* end of miscellaneous */
+
+private:
+    /* begin of private data members and alias members */
+    // stateless, only routes construction through the bulk paths of tgp/memory.h
+    using alloc_type = std::allocator<value_type>;
+
+    static constexpr bool trivially_relocatable = is_trivially_allocator_relocatable_v<alloc_type, value_type>;
+
+    // elements may be written through a raw pointer and dropped without being destroyed
+    static constexpr bool overwritable = is_implicit_lifetime_v<value_type> &&
+                                         std::is_trivially_destructible_v<value_type>;
+
+    // only the first size_ elements are alive, the union keeps the others from being constructed
+    union { value_type elems_[N]; };
+    size_type size_ = 0;
+    /* end of private data members and alias members */
+
+
+    /* begin of private function members */
+    constexpr void check_room(const size_type count) const {
+        if (count > N - size_)
+            TGP_TRY_THROW(std::bad_alloc());
+    }
+
+    constexpr void construct_at_end(const size_type n) {
+        alloc_type alloc;
+        size_ = static_cast<size_type>(uninitialized_allocator_value_construct_n(alloc, end(), n) - data());
+    }
+
+    constexpr void construct_at_end(const size_type n, default_init_t) {
+        alloc_type alloc;
+        size_ = static_cast<size_type>(uninitialized_allocator_default_construct_n(alloc, end(), n) - data());
+    }
+
+    constexpr void construct_at_end(const size_type n, const value_type& value) {
+        alloc_type alloc;
+        size_ = static_cast<size_type>(uninitialized_allocator_fill_n(alloc, end(), n, value) - data());
+    }
+
+    template<class Iter>
+    constexpr void construct_at_end(Iter first, Iter last) {
+        alloc_type alloc;
+        size_ = static_cast<size_type>(uninitialized_allocator_copy(alloc, first, last, end()) - data());
+    }
+
+    template<class... Args>
+    constexpr reference construct_one_at_end(Args&&... args) {
+        alloc_type alloc;
+        std::allocator_traits<alloc_type>::construct(alloc, end(), std::forward<Args>(args)...);
+        return data()[size_++];
+    }
+
+    constexpr void destruct_at_end(pointer new_end) noexcept {
+        alloc_type alloc;
+        allocator_destroy(alloc, new_end, end());
+        size_ = static_cast<size_type>(new_end - data());
+    }
+
+    // like vector::move_range, moves [from_s, from_e) to to and extends the end accordingly
+    constexpr void move_range(pointer from_s, pointer from_e, pointer to) {
+        if constexpr (trivially_relocatable) {
+            alloc_type alloc;
+            allocator_trivially_relocate(alloc, from_s, from_e, to);
+            size_ += static_cast<size_type>(to - from_s);
+        } else {
+            pointer old_last = end();
+            difference_type n = old_last - to;
+            for (pointer p = from_s + n; p < from_e; ++p)
+                construct_one_at_end(std::move(*p));
+            std::move_backward(from_s, from_s + n, old_last);
+        }
+    }
+
+    // undoes move_range(p, end(), p + n) for trivially relocatable elements
+    constexpr void close_gap(pointer p, const size_type n) noexcept {
+        alloc_type alloc;
+        allocator_trivially_relocate(alloc, p + n, end(), p);
+        size_ -= n;
+    }
+
+    // checks for room before anything moves, so an insertion that does not fit leaves the elements as they are
+    template<class ForwardIt>
+    constexpr iterator insert_with_size(const_iterator pos, ForwardIt first, ForwardIt last, size_type count) {
+        pointer p = data() + (pos - begin());
+        check_room(count);
+        if (p == end()) {
+            construct_at_end(first, last);
+        } else if constexpr (trivially_relocatable) {
+            move_range(p, end(), p + count);
+            TGP_TRY {
+                alloc_type alloc;
+                uninitialized_allocator_copy(alloc, first, last, p);
+            } TGP_CATCH (...) {
+                close_gap(p, count);
+                TGP_THROW;
+            }
+        } else {
+            const auto m = static_cast<size_type>(end() - p);
+            const size_type old_count = count;
+            ForwardIt mid = last;
+            if (count > m) {
+                mid = std::next(first, m);
+                construct_at_end(mid, last);
+                count = m;
+            }
+            if (count > 0) {
+                move_range(p, p + m, p + old_count);
+                std::copy(first, mid, p);
+            }
+        }
+        return p;
+    }
+
+    // appends the new elements and rotates them into place, there is no room for a side buffer
+    template<class InputIt, class Sentinel>
+    constexpr iterator insert_single_pass(const_iterator pos, InputIt first, Sentinel last) {
+        const difference_type n = pos - begin();
+        const size_type old_size = size_;
+        TGP_TRY {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        } TGP_CATCH (...) {
+            destruct_at_end(data() + old_size);
+            TGP_THROW;
+        }
+        std::rotate(begin() + n, begin() + old_size, end());
+        return begin() + n;
+    }
+
+    template<class ForwardIt>
+    constexpr void assign_with_size(ForwardIt first, ForwardIt last, const size_type count) {
+        if (count > N)
+            TGP_TRY_THROW(std::bad_alloc());
+        if (count > size_) {
+            ForwardIt mid = std::next(first, size_);
+            std::copy(first, mid, data());
+            construct_at_end(mid, last);
+        } else {
+            std::copy(first, last, data());
+            destruct_at_end(data() + count);
+        }
+    }
+
+    template<class InputIt, class Sentinel>
+    constexpr void assign_single_pass(InputIt first, Sentinel last) {
+        pointer cur = data();
+        for (; cur != end() && first != last; ++first, (void)++cur)
+            *cur = *first;
+        if (cur == end()) {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        } else {
+            destruct_at_end(cur);
+        }
+    }
+
+    TGP_NODISCARD constexpr bool is_internal_element_ref(const value_type& value) const {
+        // ordering pointers into different objects is not a constant expression, testing them for equality is
+        if (TGP_IS_CONSTANT_EVALUATED()) {
+            for (const_pointer p = data(); p != end(); ++p) {
+                if (p == std::addressof(value))
+                    return true;
+            }
+            return false;
+        }
+        return std::addressof(value) >= data() && std::addressof(value) < end();
+    }
+    /* end of private function members */
+
+}; // end of class static_vector
+
+template<class T, std::size_t N, class U>
+constexpr typename static_vector<T, N>::size_type erase(static_vector<T, N>& c, const U& value) {
+    const auto old_size = c.size();
+    c.erase(std::remove(c.begin(), c.end(), value), c.end());
+    return old_size - c.size();
+}
+
+template<class T, std::size_t N, class Pred>
+constexpr typename static_vector<T, N>::size_type erase_if(static_vector<T, N>& c, Pred pred) {
+    const auto old_size = c.size();
+    c.erase(std::remove_if(c.begin(), c.end(), pred), c.end());
+    return old_size - c.size();
+}
+
+NAMESPACE_TGP_END
+
+namespace std {
+
+template<class T, std::size_t N>
+constexpr void swap(tgp::static_vector<T, N>& lhs, tgp::static_vector<T, N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+} // end of namespace std
+
+#endif // end of TSTL_INCLUDE_TGP_STATIC_VECTOR_H
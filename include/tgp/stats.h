@@ -0,0 +1,243 @@
+#ifndef TSTL_INCLUDE_TGP_STATS_H
+#define TSTL_INCLUDE_TGP_STATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <tgp/config.h>
+
+/*
+ * what containers do with their buffers, counted per container, per tag and for the whole program.
+ * containers only count when TGP_ENABLE_STATS is defined (see config.h), otherwise they hold no counters
+ * and run no extra code. tags are names a caller hands to a container's set_stats_tag, so that e.g. every
+ * vector of a subsystem adds up under one line of dump_stats.
+ */
+
+NAMESPACE_TGP_BEGIN
+
+/* begin of stats_counters */
+// all sizes are in bytes
+struct stats_counters {
+    std::uint64_t allocations     = 0; // buffers obtained from the allocator, growth in place included
+    std::uint64_t relocations     = 0; // times the elements were moved into another buffer
+    std::uint64_t elements_moved  = 0;
+    std::uint64_t bytes_moved     = 0;
+    std::uint64_t peak_capacity   = 0; // the largest buffer
+    std::uint64_t wasted_capacity = 0; // the unused part of a container's buffer, summed over the released
+                                       // buffers for tags and globally
+};
+/* end of stats_counters */
+
+
+/* begin of stats_record */
+// stats_counters shared between threads
+class stats_record {
+public:
+    /* begin of function members */
+    void add_allocation(const std::uint64_t bytes) noexcept {
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        std::uint64_t peak = peak_capacity_.load(std::memory_order_relaxed);
+        while (peak < bytes && !peak_capacity_.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {}
+    }
+
+    void add_relocation(const std::uint64_t elements, const std::uint64_t bytes) noexcept {
+        relocations_.fetch_add(1, std::memory_order_relaxed);
+        elements_moved_.fetch_add(elements, std::memory_order_relaxed);
+        bytes_moved_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void add_release(const std::uint64_t wasted_bytes) noexcept {
+        wasted_capacity_.fetch_add(wasted_bytes, std::memory_order_relaxed);
+    }
+
+    TGP_NODISCARD stats_counters snapshot() const noexcept {
+        stats_counters c;
+        c.allocations     = allocations_.load(std::memory_order_relaxed);
+        c.relocations     = relocations_.load(std::memory_order_relaxed);
+        c.elements_moved  = elements_moved_.load(std::memory_order_relaxed);
+        c.bytes_moved     = bytes_moved_.load(std::memory_order_relaxed);
+        c.peak_capacity   = peak_capacity_.load(std::memory_order_relaxed);
+        c.wasted_capacity = wasted_capacity_.load(std::memory_order_relaxed);
+        return c;
+    }
+
+    void reset() noexcept {
+        allocations_.store(0, std::memory_order_relaxed);
+        relocations_.store(0, std::memory_order_relaxed);
+        elements_moved_.store(0, std::memory_order_relaxed);
+        bytes_moved_.store(0, std::memory_order_relaxed);
+        peak_capacity_.store(0, std::memory_order_relaxed);
+        wasted_capacity_.store(0, std::memory_order_relaxed);
+    }
+    /* end of function members */
+
+private:
+    /* begin of private data members */
+    std::atomic<std::uint64_t> allocations_{0};
+    std::atomic<std::uint64_t> relocations_{0};
+    std::atomic<std::uint64_t> elements_moved_{0};
+    std::atomic<std::uint64_t> bytes_moved_{0};
+    std::atomic<std::uint64_t> peak_capacity_{0};
+    std::atomic<std::uint64_t> wasted_capacity_{0};
+    /* end of private data members */
+
+}; // end of class stats_record
+/* end of stats_record */
+
+
+/* begin of stats_registry */
+struct stats_snapshot {
+    stats_counters global;
+    std::vector<std::pair<std::string, stats_counters>> tags; // sorted by tag
+};
+
+// the global record and one record per tag. records are never removed, so containers may keep pointers to them
+class stats_registry {
+public:
+    /* begin of function members */
+    TGP_NODISCARD static stats_registry& instance() {
+        static stats_registry registry;
+        return registry;
+    }
+
+    TGP_NODISCARD stats_record& global() noexcept {
+        return global_;
+    }
+
+    TGP_NODISCARD stats_record& tag(const std::string_view name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = tags_.find(name);
+        if (it == tags_.end())
+            it = tags_.try_emplace(std::string(name)).first;
+        return it->second;
+    }
+
+    TGP_NODISCARD stats_snapshot snapshot() const {
+        stats_snapshot s;
+        s.global = global_.snapshot();
+        std::lock_guard<std::mutex> lock(mutex_);
+        s.tags.reserve(tags_.size());
+        for (const auto& [name, record] : tags_)
+            s.tags.emplace_back(name, record.snapshot());
+        return s;
+    }
+
+    // zeroes every record but keeps the tags, containers may still point to them
+    void reset() noexcept {
+        global_.reset();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& tagged : tags_)
+            tagged.second.reset();
+    }
+    /* end of function members */
+
+private:
+    /* begin of private data members */
+    mutable std::mutex mutex_;
+    stats_record global_;
+    std::map<std::string, stats_record, std::less<>> tags_;
+    /* end of private data members */
+
+}; // end of class stats_registry
+
+TGP_NODISCARD inline stats_snapshot snapshot_stats() {
+    return stats_registry::instance().snapshot();
+}
+
+inline void reset_stats() noexcept {
+    stats_registry::instance().reset();
+}
+
+// one line per tag and one for the whole program
+inline void dump_stats(std::ostream& os) {
+    const stats_snapshot s = snapshot_stats();
+    const auto line = [&os](const std::string_view name, const stats_counters& c) {
+        os << name << ": allocations " << c.allocations << ", relocations " << c.relocations
+           << ", elements moved " << c.elements_moved << ", bytes moved " << c.bytes_moved
+           << ", peak capacity " << c.peak_capacity << ", wasted capacity " << c.wasted_capacity << '\n';
+    };
+    for (const auto& [name, counters] : s.tags)
+        line(name, counters);
+    line("<global>", s.global);
+}
+/* end of stats_registry */
+
+
+/* begin of container_stats */
+/*
+ * the counters a container carries when TGP_ENABLE_STATS is defined. everything is counted here, in the
+ * global record and in the record of the container's tag, if it has one.
+ * the counters and the tag belong to the container object, a copy or move of a container starts untagged
+ * and counts only what happens to itself.
+ */
+class container_stats {
+public:
+    /* begin of constructor and assignment */
+    container_stats() noexcept = default;
+
+    container_stats(const container_stats&) noexcept {}
+
+    container_stats& operator=(const container_stats&) noexcept {
+        return *this;
+    }
+    /* end of constructor and assignment */
+
+
+    /* begin of function members */
+    void set_tag(const std::string_view name) {
+        tag_ = &stats_registry::instance().tag(name);
+    }
+
+    void on_allocation(const std::uint64_t bytes) noexcept {
+        ++local_.allocations;
+        if (local_.peak_capacity < bytes)
+            local_.peak_capacity = bytes;
+        stats_registry::instance().global().add_allocation(bytes);
+        if (tag_)
+            tag_->add_allocation(bytes);
+    }
+
+    void on_relocation(const std::uint64_t elements, const std::uint64_t bytes) noexcept {
+        ++local_.relocations;
+        local_.elements_moved += elements;
+        local_.bytes_moved += bytes;
+        stats_registry::instance().global().add_relocation(elements, bytes);
+        if (tag_)
+            tag_->add_relocation(elements, bytes);
+    }
+
+    void on_release(const std::uint64_t wasted_bytes) noexcept {
+        stats_registry::instance().global().add_release(wasted_bytes);
+        if (tag_)
+            tag_->add_release(wasted_bytes);
+    }
+
+    // the container reports what its buffer wastes right now
+    TGP_NODISCARD stats_counters counters(const std::uint64_t wasted_bytes) const noexcept {
+        stats_counters c = local_;
+        c.wasted_capacity = wasted_bytes;
+        return c;
+    }
+    /* end of function members */
+
+private:
+    /* begin of private data members */
+    stats_counters local_;
+    stats_record* tag_ = nullptr;
+    /* end of private data members */
+
+}; // end of class container_stats
+/* end of container_stats */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_STATS_H
@@ -0,0 +1,167 @@
+#ifndef TSTL_INCLUDE_TGP_TRACKING_ALLOCATOR_H
+#define TSTL_INCLUDE_TGP_TRACKING_ALLOCATOR_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+#include <tgp/config.h>
+#include <tgp/memory.h>
+
+NAMESPACE_TGP_BEGIN
+
+/* begin of size_histogram */
+// allocation sizes in bytes, bucket i counts the sizes in [2^(i-1), 2^i), bucket 0 the empty ones
+class size_histogram {
+public:
+    static constexpr std::size_t bucket_count = 65;
+
+    /* begin of function members */
+    void record(const std::size_t bytes) noexcept {
+        buckets_[bucket_of(bytes)].fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    TGP_NODISCARD static std::size_t bucket_of(const std::size_t bytes) noexcept {
+        return static_cast<std::size_t>(std::bit_width(bytes));
+    }
+
+    TGP_NODISCARD std::uint64_t count(const std::size_t bucket) const noexcept {
+        TGP_PRECONDITION(bucket < bucket_count);
+        return buckets_[bucket].load(std::memory_order_relaxed);
+    }
+
+    TGP_NODISCARD std::uint64_t total_count() const noexcept {
+        std::uint64_t n = 0;
+        for (const auto& b : buckets_)
+            n += b.load(std::memory_order_relaxed);
+        return n;
+    }
+
+    TGP_NODISCARD std::uint64_t total_bytes() const noexcept {
+        return bytes_.load(std::memory_order_relaxed);
+    }
+
+    void reset() noexcept {
+        for (auto& b : buckets_)
+            b.store(0, std::memory_order_relaxed);
+        bytes_.store(0, std::memory_order_relaxed);
+    }
+
+    // one line per non-empty bucket
+    void dump(std::ostream& os) const {
+        for (std::size_t i = 0; i < bucket_count; ++i) {
+            if (const std::uint64_t n = count(i)) {
+                const std::uint64_t lo = i == 0 ? 0 : std::uint64_t(1) << (i - 1);
+                os << '[' << lo << ", ";
+                if (i == bucket_count - 1)
+                    os << "inf";
+                else
+                    os << (std::uint64_t(1) << i);
+                os << "): " << n << '\n';
+            }
+        }
+        os << "total: " << total_count() << " allocations, " << total_bytes() << " bytes\n";
+    }
+    /* end of function members */
+
+private:
+    /* begin of private data members */
+    std::atomic<std::uint64_t> buckets_[bucket_count] = {};
+    std::atomic<std::uint64_t> bytes_{0};
+    /* end of private data members */
+
+}; // end of class size_histogram
+/* end of size_histogram */
+
+
+/* begin of tracking_allocator */
+/*
+ * forwards to the upstream allocator and records the size of every allocation in a size_histogram.
+ * copies and rebinds share the histogram, which has to outlive them. it has neither construct nor destroy,
+ * so containers keep relocating trivially relocatable elements with memmove.
+ */
+template<class Allocator>
+class tracking_allocator {
+    using upstream_traits = std::allocator_traits<Allocator>;
+
+    template<class> friend class tracking_allocator;
+
+public:
+    /* begin of public alias members */
+    using value_type                             = typename upstream_traits::value_type;
+    using pointer                                = typename upstream_traits::pointer;
+    using size_type                              = typename upstream_traits::size_type;
+    using difference_type                        = typename upstream_traits::difference_type;
+    using propagate_on_container_copy_assignment = typename upstream_traits::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = typename upstream_traits::propagate_on_container_move_assignment;
+    using propagate_on_container_swap            = typename upstream_traits::propagate_on_container_swap;
+    using is_always_equal                        = typename upstream_traits::is_always_equal;
+
+    template<class U>
+    struct rebind {
+        using other = tracking_allocator<typename upstream_traits::template rebind_alloc<U>>;
+    };
+    /* end of public alias members */
+
+
+    /* begin of function members */
+    explicit tracking_allocator(size_histogram& histogram, const Allocator& upstream = Allocator()) noexcept
+        : histogram_(&histogram), upstream_(upstream) {}
+
+    template<class OtherAllocator>
+    tracking_allocator(const tracking_allocator<OtherAllocator>& other) noexcept
+        : histogram_(other.histogram_), upstream_(other.upstream_) {}
+
+    TGP_NODISCARD pointer allocate(const size_type n) {
+        pointer p = upstream_traits::allocate(upstream_, n);
+        histogram_->record(n * sizeof(value_type));
+        return p;
+    }
+
+    // records what the block really holds
+    TGP_NODISCARD allocation_result<pointer, size_type> allocate_at_least(const size_type n) {
+        auto allocation = tgp::allocate_at_least(upstream_, n);
+        histogram_->record(allocation.count * sizeof(value_type));
+        return allocation;
+    }
+
+    void deallocate(pointer p, const size_type n) noexcept {
+        upstream_traits::deallocate(upstream_, p, n);
+    }
+
+    TGP_NODISCARD size_type max_size() const noexcept {
+        return upstream_traits::max_size(upstream_);
+    }
+
+    TGP_NODISCARD size_histogram& histogram() const noexcept {
+        return *histogram_;
+    }
+
+    TGP_NODISCARD const Allocator& upstream() const noexcept {
+        return upstream_;
+    }
+
+    // blocks only ever come from upstream, so the histograms do not matter
+    template<class OtherAllocator>
+    TGP_NODISCARD friend bool operator==(const tracking_allocator& lhs,
+                                         const tracking_allocator<OtherAllocator>& rhs) noexcept {
+        return lhs.upstream_ == rhs.upstream();
+    }
+    /* end of function members */
+
+private:
+    /* begin of private data members */
+    size_histogram* histogram_;
+    Allocator upstream_;
+    /* end of private data members */
+
+}; // end of class tracking_allocator
+/* end of tracking_allocator */
+
+NAMESPACE_TGP_END
+
+#endif // end of TSTL_INCLUDE_TGP_TRACKING_ALLOCATOR_H
@@ -1,13 +1,195 @@
 #ifndef TSTL_INCLUDE_TGP_TYPE_TRAITS_H
 #define TSTL_INCLUDE_TGP_TYPE_TRAITS_H
 
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <type_traits>
 
 #include <tgp/config.h>
 
 NAMESPACE_TGP_BEGIN
 
-// TODO: here
+/* begin of is_trivially_relocatable */
+/*
+ * a type is trivially relocatable if moving an object to a new address and ending the lifetime
+ * of the old one is equivalent to copying its bytes. it's the case for every trivially copyable
+ * type, and also for most handle-like types whose move constructor is not trivial.
+ * users may specialize it for their own types:
+ *
+ *      template<>
+ *      struct tgp::is_trivially_relocatable<my_handle> : std::true_type {};
+ */
+template<class T>
+struct is_trivially_relocatable
+#if defined(__has_builtin)
+#   if __has_builtin(__is_trivially_relocatable)
+    : bool_constant<__is_trivially_relocatable(T)> {};
+#   else
+    : bool_constant<std::is_trivially_copyable<T>::value> {};
+#   endif
+#else
+    : bool_constant<std::is_trivially_copyable<T>::value> {};
+#endif
+
+template<class T>
+struct is_trivially_relocatable<std::unique_ptr<T, std::default_delete<T>>> : std::true_type {};
+
+template<class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+/* end of is_trivially_relocatable */
+
+
+/* begin of is_implicit_lifetime */
+/*
+ * objects of implicit-lifetime types come to life when their storage is written, so such elements may be
+ * filled in place through a raw pointer. without compiler support it falls back to the types whose lifetime
+ * can be told by the standard traits, missing aggregates with a user-provided destructor.
+ */
+template<class T>
+struct is_implicit_lifetime
+#if defined(__cpp_lib_is_implicit_lifetime)
+    : bool_constant<std::is_implicit_lifetime_v<T>> {};
+#elif defined(__has_builtin)
+#   if __has_builtin(__builtin_is_implicit_lifetime)
+    : bool_constant<__builtin_is_implicit_lifetime(T)> {};
+#   else
+    : bool_constant<std::is_scalar_v<T> || std::is_array_v<T> ||
+                    (std::is_class_v<T> && std::is_trivially_destructible_v<T> &&
+                     (std::is_aggregate_v<T> || std::is_trivially_default_constructible_v<T> ||
+                      std::is_trivially_copy_constructible_v<T> || std::is_trivially_move_constructible_v<T>))> {};
+#   endif
+#else
+    : bool_constant<std::is_scalar_v<T> || std::is_array_v<T> ||
+                    (std::is_class_v<T> && std::is_trivially_destructible_v<T> &&
+                     (std::is_aggregate_v<T> || std::is_trivially_default_constructible_v<T> ||
+                      std::is_trivially_copy_constructible_v<T> || std::is_trivially_move_constructible_v<T>))> {};
+#endif
+
+template<class T>
+inline constexpr bool is_implicit_lifetime_v = is_implicit_lifetime<T>::value;
+/* end of is_implicit_lifetime */
+
+
+/* begin of allocator_has_construct */
+template<class, class Alloc, class... Args>
+struct allocator_has_construct_impl : std::false_type {};
+
+template<class Alloc, class... Args>
+struct allocator_has_construct_impl<void_t<decltype(std::declval<Alloc&>().construct(std::declval<Args>()...))>,
+                                    Alloc, Args...>
+    : std::true_type {};
+
+template<class Alloc, class... Args>
+struct allocator_has_construct : allocator_has_construct_impl<void, Alloc, Args...> {};
+
+template<class Alloc, class... Args>
+inline constexpr bool allocator_has_construct_v = allocator_has_construct<Alloc, Args...>::value;
+/* end of allocator_has_construct */
+
+
+/* begin of allocator_has_destroy */
+template<class Alloc, class Pointer, class = void>
+struct allocator_has_destroy : std::false_type {};
+
+template<class Alloc, class Pointer>
+struct allocator_has_destroy<Alloc, Pointer, void_t<decltype(std::declval<Alloc&>().destroy(std::declval<Pointer>()))>>
+    : std::true_type {};
+
+template<class Alloc, class Pointer>
+inline constexpr bool allocator_has_destroy_v = allocator_has_destroy<Alloc, Pointer>::value;
+/* end of allocator_has_destroy */
+
+
+/* begin of allocator_has_trivial_construct and allocator_has_trivial_destroy */
+// std::allocator's construct and destroy (if any) do exactly what allocator_traits would do without them
+template<class Alloc>
+struct is_std_allocator : std::false_type {};
+
+template<class T>
+struct is_std_allocator<std::allocator<T>> : std::true_type {};
+
+template<class Alloc, class T, class... Args>
+struct allocator_has_trivial_construct
+    : bool_constant<is_std_allocator<Alloc>::value || !allocator_has_construct<Alloc, T*, Args...>::value> {};
+
+template<class Alloc, class T, class... Args>
+inline constexpr bool allocator_has_trivial_construct_v = allocator_has_trivial_construct<Alloc, T, Args...>::value;
+
+template<class Alloc, class T>
+struct allocator_has_trivial_destroy
+    : bool_constant<is_std_allocator<Alloc>::value || !allocator_has_destroy<Alloc, T*>::value> {};
+
+template<class Alloc, class T>
+inline constexpr bool allocator_has_trivial_destroy_v = allocator_has_trivial_destroy<Alloc, T>::value;
+/* end of allocator_has_trivial_construct and allocator_has_trivial_destroy */
+
+
+/* begin of is_trivially_allocator_relocatable */
+// whether elements of type T held by Alloc may be relocated with memmove without bypassing the allocator. the
+// containers then move their elements' bytes in one call instead of moving and destroying them one by one
+template<class Alloc, class T>
+struct is_trivially_allocator_relocatable
+    : bool_constant<is_trivially_relocatable<T>::value &&
+                    allocator_has_trivial_construct<Alloc, T, T&&>::value &&
+                    allocator_has_trivial_destroy<Alloc, T>::value> {};
+
+template<class Alloc, class T>
+inline constexpr bool is_trivially_allocator_relocatable_v = is_trivially_allocator_relocatable<Alloc, T>::value;
+/* end of is_trivially_allocator_relocatable */
+
+
+/* begin of iterator category traits */
+// whether iterator_traits<Iter>::iterator_category exists and converts to Category, false for non-iterators
+template<class Iter, class Category, class = void>
+struct has_iterator_category_convertible_to : std::false_type {};
+
+template<class Iter, class Category>
+struct has_iterator_category_convertible_to<Iter, Category,
+                                            void_t<typename std::iterator_traits<Iter>::iterator_category>>
+    : bool_constant<std::is_convertible<typename std::iterator_traits<Iter>::iterator_category, Category>::value> {};
+
+template<class Iter>
+struct has_input_iterator_category : has_iterator_category_convertible_to<Iter, std::input_iterator_tag> {};
+
+template<class Iter>
+struct has_forward_iterator_category : has_iterator_category_convertible_to<Iter, std::forward_iterator_tag> {};
+
+// single-pass iterators, which have to be read in one go
+template<class Iter>
+struct has_exactly_input_iterator_category
+    : bool_constant<has_input_iterator_category<Iter>::value && !has_forward_iterator_category<Iter>::value> {};
+/* end of iterator category traits */
+
+
+/* begin of is_contiguous_iterator */
+template<class Iter>
+struct is_contiguous_iterator
+#if TGP_STD_VER >= 20
+    : bool_constant<std::contiguous_iterator<Iter>> {};
+#else
+    : bool_constant<std::is_pointer<Iter>::value> {};
+#endif
+
+template<class Iter>
+inline constexpr bool is_contiguous_iterator_v = is_contiguous_iterator<Iter>::value;
+/* end of is_contiguous_iterator */
+
+
+/* begin of is_zero_initializable */
+/*
+ * whether a value-initialized T is represented by all-zero bytes, so that value-initializing a range may be
+ * done by memset. it holds for scalar types except pointers to data member, users may specialize it for
+ * their own trivial types.
+ */
+template<class T>
+struct is_zero_initializable
+    : bool_constant<std::is_scalar<T>::value && !std::is_member_object_pointer<T>::value &&
+                    (!std::is_floating_point<T>::value || std::numeric_limits<T>::is_iec559)> {};
+
+template<class T>
+inline constexpr bool is_zero_initializable_v = is_zero_initializable<T>::value;
+/* end of is_zero_initializable */
 
 NAMESPACE_TGP_END
 
@@ -6,14 +6,24 @@
 #include <memory>
 #include <type_traits>
 #include <stdexcept>
+#include <tuple>
 
 #include <tgp/config.h>
 #include <tgp/exception.h>
+#include <tgp/execution_fwd.h>
+#include <tgp/growth_policy.h>
+#include <tgp/memory.h>
 #include <tgp/split_buffer.h>
+#include <tgp/type_traits.h>
 #include <tgp/compare.h>
 
+#ifdef TGP_ENABLE_STATS
+#   include <string_view>
+#   include <tgp/stats.h>
+#endif
+
 NAMESPACE_TGP_BEGIN
-template<class T, class Allocator = std::allocator<T>>
+template<class T, class Allocator = std::allocator<T>, class GrowthPolicy = double_growth>
 class vector {
     static_assert(is_same_v<T, typename Allocator::value_type>);
 
@@ -21,6 +31,7 @@ public:
     /* begin of public alias members */
     using value_type                = T;
     using allocator_type            = Allocator;
+    using growth_policy             = GrowthPolicy;
     using size_type                 = size_t;
     using difference_type           = ptrdiff_t;
     using reference                 = value_type&;
@@ -54,6 +65,20 @@ public:
         }
     }
 
+    // leaves trivially default constructible elements uninitialized, for buffers about to be overwritten
+    TGP_CONSTEXPR_SINCE_CXX20 vector(const size_type count, default_init_t, const allocator_type& alloc = allocator_type())
+        : alloc_(alloc) {
+        if (count > 0) {
+            TGP_TRY {
+                allocate_vector(count);
+                construct_at_end(count, default_init);
+            } TGP_CATCH (...) {
+                destroy_vector();
+                TGP_THROW;
+            }
+        }
+    }
+
     TGP_CONSTEXPR_SINCE_CXX20 vector(size_type count, const value_type& value, const allocator_type& alloc = allocator_type())
         : alloc_(alloc) {
         if (count > 0) {
@@ -67,7 +92,36 @@ public:
         }
     }
 
-    template<class InputIt, enable_if_t<std::__has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    // constructs the elements from several threads, each first-touching the pages it constructs. the parallel
+    // overloads need tgp/execution.h
+    vector(const parallel_policy& policy, const size_type count, const allocator_type& alloc = allocator_type())
+        : alloc_(alloc) {
+        if (count > 0) {
+            TGP_TRY {
+                allocate_vector(count);
+                construct_at_end(policy, count);
+            } TGP_CATCH (...) {
+                destroy_vector();
+                TGP_THROW;
+            }
+        }
+    }
+
+    vector(const parallel_policy& policy, const size_type count, const value_type& value,
+           const allocator_type& alloc = allocator_type())
+        : alloc_(alloc) {
+        if (count > 0) {
+            TGP_TRY {
+                allocate_vector(count);
+                construct_at_end(policy, count, value);
+            } TGP_CATCH (...) {
+                destroy_vector();
+                TGP_THROW;
+            }
+        }
+    }
+
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
     TGP_CONSTEXPR_SINCE_CXX20 vector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
         : alloc_(alloc) {
         TGP_TRY {
@@ -79,7 +133,7 @@ public:
         }
     }
 
-    template<class InputIt, enable_if_t<std::__has_forward_iterator_category<InputIt>::value, int> = 0>
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
     TGP_CONSTEXPR_SINCE_CXX20 vector(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
         : alloc_(alloc) {
         auto count = static_cast<size_type>(std::distance(first, last));
@@ -131,18 +185,51 @@ public:
     vector(std::initializer_list<value_type> init, const allocator_type& alloc = allocator_type())
         : vector(init.begin(), init.end(), alloc) {}
 
+#if TGP_STD_VER >= 20
+    // allocates once for a forward or sized range, a single-pass range of unknown size grows as it is read
+    template<container_compatible_range<T> R>
+    constexpr vector(from_range_t, R&& rg, const allocator_type& alloc = allocator_type())
+        : alloc_(alloc) {
+        TGP_TRY {
+            if constexpr (std::ranges::forward_range<R>) {
+                const auto [first, last, count] = forward_range_bounds(rg);
+                if (count > 0) {
+                    allocate_vector(count);
+                    construct_at_end(first, last);
+                }
+            } else {
+                if constexpr (std::ranges::sized_range<R>)
+                    reserve(static_cast<size_type>(std::ranges::size(rg)));
+                for (auto it = std::ranges::begin(rg); it != std::ranges::end(rg); ++it)
+                    emplace_back(*it);
+            }
+        } TGP_CATCH (...) {
+            destroy_vector();
+            TGP_THROW;
+        }
+    }
+#endif
+
+    // kept small enough to be inlined into cold unwinding paths too, an out-of-line call there lets the vector's
+    // address escape and keeps its pointers in memory through the caller's hot loops
     TGP_CONSTEXPR_SINCE_CXX20 ~vector() {
-        destroy_vector();
+        if (begin_) {
+            TGP_STATS_ONLY(stats_on_release();)
+            allocator_destroy(alloc_, tgp::to_address(begin_), tgp::to_address(end_));
+            alloc_traits::deallocate(alloc_, begin_, capacity());
+        }
     }
     /* end of constructor and destructor */
 
 
     /* begin of element access */
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reference operator[] (const size_type pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
         return begin_[pos];
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reference operator[] (const size_type pos) const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos < size());
         return begin_[pos];
     }
 
@@ -159,27 +246,31 @@ public:
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reference front() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
         return *begin_;
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reference front() const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
         return *begin_;
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 reference back() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
         return *(end_ - 1);
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const_reference back() const {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
         return *(end_ - 1);
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 value_type* data() noexcept {
-        return std::__to_address(begin_);
+        return tgp::to_address(begin_);
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 const value_type* data() const noexcept {
-        return std::__to_address(begin_);
+        return tgp::to_address(begin_);
     }
     /* end of element access */
 
@@ -256,8 +347,14 @@ public:
         if (new_cap > capacity()) {
             if (new_cap > max_size())
                 TGP_TRY_THROW(std::length_error("tgp::vector::reserve demanding size exceeds max size"));
-            split_buffer<value_type, allocator_type&> sb(new_cap, size(), alloc_);
-            swap_with_split_buffer(sb);
+            if (expand_in_place(new_cap)) {
+                return;
+            } else if constexpr (reallocatable) {
+                reallocate_vector(new_cap);
+            } else {
+                split_buffer<value_type, allocator_type&> sb(new_cap, size(), alloc_);
+                swap_with_split_buffer(sb);
+            }
         }
     }
 
@@ -280,36 +377,91 @@ public:
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 iterator erase(const_iterator pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos != end());
         pointer p = begin_ + (pos - begin());
-        destruct_at_end(std::move(p + 1, end_, p));
+        if constexpr (trivially_relocatable) {
+            alloc_traits::destroy(alloc_, tgp::to_address(p));
+            allocator_trivially_relocate(alloc_, tgp::to_address(p + 1), tgp::to_address(end_), tgp::to_address(p));
+            --end_;
+        } else {
+            destruct_at_end(std::move(p + 1, end_, p));
+        }
         return p;
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 iterator erase(const_iterator first, const_iterator last) {
+        TGP_ASSERT_VALID_INPUT_RANGE(first <= last);
         pointer p = begin_ + (first - begin());
-        destruct_at_end(std::move(p + (last - first), end_, p));
+        if (first != last) {
+            if constexpr (trivially_relocatable) {
+                pointer q = p + (last - first);
+                allocator_destroy(alloc_, tgp::to_address(p), tgp::to_address(q));
+                allocator_trivially_relocate(alloc_, tgp::to_address(q), tgp::to_address(end_), tgp::to_address(p));
+                end_ -= (q - p);
+            } else {
+                destruct_at_end(std::move(p + (last - first), end_, p));
+            }
+        }
         return p;
     }
 
-    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, const value_type& value) {
-        return insert(pos, 1, value);
-    }
-
-    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, value_type&& value) {
+    // moves the last element into the hole instead of shifting the tail, so the order is not kept
+    TGP_CONSTEXPR_SINCE_CXX20 iterator erase_unordered(const_iterator pos) {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(pos != end());
         pointer p = begin_ + (pos - begin());
-        if (end_ == cap_) {
-            split_buffer<value_type, allocator_type&> sb(recommend_cap(size() + 1), p - begin_, alloc_);
-            sb.construct_at_end(std::move(value));
-            p = swap_with_split_buffer(sb, p);
+        pointer last = end_ - 1;
+        if constexpr (trivially_relocatable) {
+            alloc_traits::destroy(alloc_, tgp::to_address(p));
+            if (p != last)
+                allocator_trivially_relocate(alloc_, tgp::to_address(last), tgp::to_address(end_), tgp::to_address(p));
+            --end_;
         } else {
-            if (p == end_) {
-                construct_one_at_end(std::move(value));
+            if (p != last)
+                *p = std::move(*last);
+            destruct_at_end(last);
+        }
+        return p;
+    }
+
+    /*
+     * erases the elements at the given strictly increasing indices, moving each survivor at most once.
+     * returns how many elements were erased.
+     */
+    template<class IndexRange>
+    TGP_CONSTEXPR_SINCE_CXX20 size_type erase_indices(const IndexRange& indices) {
+        auto it = std::begin(indices);
+        const auto last = std::end(indices);
+        if (it == last)
+            return 0;
+        const size_type old_size = size();
+        pointer out = begin_ + static_cast<size_type>(*it);
+        while (it != last) {
+            const auto index = static_cast<size_type>(*it);
+            const size_type next = ++it == last ? old_size : static_cast<size_type>(*it);
+            TGP_PRECONDITION(index < next && next <= old_size);
+            if constexpr (trivially_relocatable) {
+                alloc_traits::destroy(alloc_, tgp::to_address(begin_ + index));
+                allocator_trivially_relocate(alloc_, tgp::to_address(begin_ + index + 1),
+                                             tgp::to_address(begin_ + next), tgp::to_address(out));
+                out += next - index - 1;
             } else {
-                move_range(p, end_, p + 1);
-                *p = std::move(value);
+                out = std::move(begin_ + index + 1, begin_ + next, out);
             }
         }
-        return p;
+        if constexpr (trivially_relocatable) {
+            end_ = out;
+        } else {
+            destruct_at_end(out);
+        }
+        return old_size - size();
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, const value_type& value) {
+        return insert(pos, 1, value);
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, std::move(value));
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, size_type count, const value_type& value) {
@@ -321,6 +473,17 @@ public:
                 p = swap_with_split_buffer(sb, p);
             } else if (p == end_) {
                 construct_at_end(count, value);
+            } else if constexpr (trivially_relocatable) {
+                const value_type* vp = std::addressof(value);
+                if (is_internal_element_ref(pos, value))
+                    vp += count;
+                move_range(p, end_, p + count);
+                TGP_TRY {
+                    uninitialized_allocator_fill_n(alloc_, tgp::to_address(p), count, *vp);
+                } TGP_CATCH (...) {
+                    close_gap(p, count);
+                    TGP_THROW;
+                }
             } else {
                 auto n = static_cast<size_type>(end_ - p);
                 size_type fill_size = std::min(count, n);
@@ -343,49 +506,53 @@ public:
         return p;
     }
 
-    template<class InputIt, enable_if_t<std::__has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
     TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, InputIt first, InputIt last) {
-        const difference_type n = pos - begin();
-        const size_type cur_size = size();
-        while (first != last) {
-            emplace_back(*first);
-            ++first;
-        }
-        std::rotate(begin() + n, begin() + cur_size, end());
-        return begin() + n;
+        return insert_single_pass(pos, std::move(first), std::move(last));
     }
 
-    template<class InputIt, enable_if_t<std::__has_forward_iterator_category<InputIt>::value, int> = 0>
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
     TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, InputIt first, InputIt last) {
-        auto count = static_cast<size_type>(std::distance(first, last));
-        const size_type n = pos - begin();
-        pointer p = begin_ + n;
-        if (count + size() > capacity()) {
-            split_buffer<value_type, allocator_type&> sb(recommend_cap(count + size()), n, alloc_);
-            sb.construct_at_end(first, last);
-            p = swap_with_split_buffer(sb, p);
-        } else {
-            auto m = static_cast<size_type>(end() - pos);
-            InputIt mid = std::next(first, count);
-            if (count > m) {
-                mid = std::next(first, m);
-                construct_at_end(mid, last);
-                count = m;
-            }
-            if (count > 0) {
-                move_range(p, p + m, end_);
-                std::copy(first, mid, p);
-            }
-        }
-        return p;
+        return insert_with_size(pos, first, last, static_cast<size_type>(std::distance(first, last)));
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 iterator insert(const_iterator pos, std::initializer_list<value_type> ilist) {
         return insert(pos, ilist.begin(), ilist.end());
     }
 
+#if TGP_STD_VER >= 20
+    // the range must not refer to elements of this vector
+    template<container_compatible_range<T> R>
+    constexpr iterator insert_range(const_iterator pos, R&& rg) {
+        if constexpr (std::ranges::forward_range<R>) {
+            const auto [first, last, count] = forward_range_bounds(rg);
+            return insert_with_size(pos, first, last, count);
+        } else if constexpr (std::ranges::sized_range<R>) {
+            return insert_single_pass(pos, std::ranges::begin(rg), std::ranges::end(rg),
+                                      static_cast<size_type>(std::ranges::size(rg)));
+        } else {
+            return insert_single_pass(pos, std::ranges::begin(rg), std::ranges::end(rg));
+        }
+    }
+
+    // grows at most once for a forward or sized range, may grow in place like emplace_back
+    template<container_compatible_range<T> R>
+    constexpr void append_range(R&& rg) {
+        if constexpr (std::ranges::forward_range<R>) {
+            const auto [first, last, count] = forward_range_bounds(rg);
+            reserve_for_append(count);
+            construct_at_end(first, last);
+        } else {
+            if constexpr (std::ranges::sized_range<R>)
+                reserve_for_append(static_cast<size_type>(std::ranges::size(rg)));
+            for (auto it = std::ranges::begin(rg); it != std::ranges::end(rg); ++it)
+                emplace_back(*it);
+        }
+    }
+#endif
+
     template<class... Args>
-    iterator emplace(const_iterator pos, Args&&... args) {
+    TGP_CONSTEXPR_SINCE_CXX20 iterator emplace(const_iterator pos, Args&&... args) {
         pointer p = begin_ + (pos - begin_);
         if (end_ == cap_) {
             split_buffer<value_type, allocator_type&> sb(recommend_cap(size() + 1), p - begin_, alloc_);
@@ -395,8 +562,13 @@ public:
             if (p == end_) {
                 construct_one_at_end(std::forward<Args>(args)...);
             } else {
+                // args may refer to an element of this vector, so build the value before shifting
+                temp_value<value_type, allocator_type> tmp(alloc_, std::forward<Args>(args)...);
                 move_range(p, end_, p + 1);
-                *p = value_type{std::forward<Args>(args)...};
+                if constexpr (trivially_relocatable)
+                    tmp.relocate_to(tgp::to_address(p));
+                else
+                    *p = std::move(tmp.get());
             }
         }
 
@@ -408,9 +580,20 @@ public:
     TGP_RETURN_TYPE_SINCE_CXX17(reference, void)
     emplace_back(Args&&... args) {
         if (end_ == cap_) {
-            split_buffer<value_type, allocator_type&> sb(recommend_cap(size() + 1), size(), alloc_);
-            sb.emplace_back(std::forward<Args>(args)...);
-            swap_with_split_buffer(sb);
+            const size_type new_cap = recommend_cap(size() + 1);
+            if (expand_in_place(new_cap)) {
+                construct_one_at_end(std::forward<Args>(args)...);
+            } else if constexpr (reallocatable) {
+                // args may refer to an element of this vector, so build the value before reallocating
+                temp_value<value_type, allocator_type> tmp(alloc_, std::forward<Args>(args)...);
+                reallocate_vector(new_cap);
+                tmp.relocate_to(tgp::to_address(end_));
+                ++end_;
+            } else {
+                split_buffer<value_type, allocator_type&> sb(new_cap, size(), alloc_);
+                sb.emplace_back(std::forward<Args>(args)...);
+                swap_with_split_buffer(sb);
+            }
         } else {
              construct_one_at_end(std::forward<Args>(args)...);
         }
@@ -426,6 +609,7 @@ public:
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 void pop_back() {
+        TGP_ASSERT_VALID_ELEMENT_ACCESS(!empty());
         destruct_at_end(end_ - 1);
     }
 
@@ -435,30 +619,133 @@ public:
             destruct_at_end(begin_ + count);
         } else {
             if (count > capacity()) {
-                split_buffer<value_type, allocator_type&> sb(recommend_cap(count), cur_size, alloc_);
-                sb.construct_at_end(count - cur_size);
-                swap_with_split_buffer(sb);
+                const size_type new_cap = recommend_cap(count);
+                if (expand_in_place(new_cap)) {
+                    construct_at_end(count - cur_size);
+                } else if constexpr (reallocatable) {
+                    reallocate_vector(new_cap);
+                    construct_at_end(count - cur_size);
+                } else {
+                    split_buffer<value_type, allocator_type&> sb(new_cap, cur_size, alloc_);
+                    sb.construct_at_end(count - cur_size);
+                    swap_with_split_buffer(sb);
+                }
             } else {
                 construct_at_end(count - cur_size);
             }
         }
     }
 
+    // leaves new trivially default constructible elements uninitialized, for buffers about to be overwritten
+    TGP_CONSTEXPR_SINCE_CXX20 void resize(const size_type count, default_init_t) {
+        const size_type cur_size = size();
+        if (count <= cur_size) {
+            destruct_at_end(begin_ + count);
+        } else {
+            if (count > capacity()) {
+                const size_type new_cap = recommend_cap(count);
+                if (expand_in_place(new_cap)) {
+                    construct_at_end(count - cur_size, default_init);
+                } else if constexpr (reallocatable) {
+                    reallocate_vector(new_cap);
+                    construct_at_end(count - cur_size, default_init);
+                } else {
+                    split_buffer<value_type, allocator_type&> sb(new_cap, cur_size, alloc_);
+                    sb.construct_at_end(count - cur_size, default_init);
+                    swap_with_split_buffer(sb);
+                }
+            } else {
+                construct_at_end(count - cur_size, default_init);
+            }
+        }
+    }
+
     TGP_CONSTEXPR_SINCE_CXX20 void resize(const size_type count, const value_type& value) {
         const size_type cur_size = size();
         if (count <= cur_size) {
             destruct_at_end(begin_ + count);
         } else {
             if (count > capacity()) {
-                split_buffer<value_type, allocator_type&> sb(recommend_cap(count), cur_size, alloc_);
-                sb.construct_at_end(count - cur_size, value);
-                swap_with_split_buffer(sb);
+                const size_type new_cap = recommend_cap(count);
+                if (expand_in_place(new_cap)) {
+                    construct_at_end(count - cur_size, value);
+                } else if constexpr (reallocatable) {
+                    // value may refer to an element of this vector, which moves along with it
+                    const difference_type offset =
+                        is_internal_element_ref(begin_, value) ? std::addressof(value) - tgp::to_address(begin_) : -1;
+                    reallocate_vector(new_cap);
+                    construct_at_end(count - cur_size, offset < 0 ? value : begin_[offset]);
+                } else {
+                    split_buffer<value_type, allocator_type&> sb(new_cap, cur_size, alloc_);
+                    sb.construct_at_end(count - cur_size, value);
+                    swap_with_split_buffer(sb);
+                }
             } else {
                 construct_at_end(count - cur_size, value);
             }
         }
     }
 
+    /*
+     * resizes to count elements and lets op(value_type* data, size_type count) write them, op returns how many of
+     * them to keep. elements past the old size are uninitialized until op writes them, like in
+     * std::string::resize_and_overwrite. if op throws the vector keeps its old elements.
+     */
+    template<class Operation>
+    TGP_CONSTEXPR_SINCE_CXX20 void resize_and_overwrite(const size_type count, Operation op) {
+        static_assert(overwritable, "tgp::vector::resize_and_overwrite requires implicit-lifetime, trivially "
+                                    "destructible elements the allocator does not construct or destroy itself");
+        if (count > capacity())
+            reserve(recommend_cap(count));
+        const auto n = static_cast<size_type>(std::move(op)(tgp::to_address(begin_), count));
+        TGP_PRECONDITION(n <= count);
+        end_ = begin_ + n;
+    }
+
+    /*
+     * lets op(value_type* out, size_type max_n) write up to max_n elements past the end and appends as many
+     * as op returns. the vector grows at most once, so decoders don't test for room on every element.
+     */
+    template<class Operation>
+    TGP_CONSTEXPR_SINCE_CXX20 void append_n(const size_type max_n, Operation op) {
+        static_assert(overwritable, "tgp::vector::append_n requires implicit-lifetime, trivially "
+                                    "destructible elements the allocator does not construct or destroy itself");
+        if (max_n > static_cast<size_type>(cap_ - end_)) {
+            if (max_n > max_size() - size())
+                TGP_TRY_THROW(std::length_error("tgp::vector::append_n demanding size exceeds max size"));
+            reserve(recommend_cap(size() + max_n));
+        }
+        const auto n = static_cast<size_type>(std::move(op)(tgp::to_address(end_), max_n));
+        TGP_PRECONDITION(n <= max_n);
+        end_ += n;
+    }
+
+    // constructs the new elements from several threads, the existing ones are relocated by the calling thread
+    void resize(const parallel_policy& policy, const size_type count) {
+        const size_type cur_size = size();
+        if (count <= cur_size) {
+            destruct_at_end(begin_ + count);
+        } else {
+            if (count > capacity())
+                reserve(recommend_cap(count));
+            construct_at_end(policy, count - cur_size);
+        }
+    }
+
+    void resize(const parallel_policy& policy, const size_type count, const value_type& value) {
+        const size_type cur_size = size();
+        if (count <= cur_size) {
+            destruct_at_end(begin_ + count);
+        } else {
+            // value may refer to an element of this vector, which moves along with it
+            const difference_type offset =
+                is_internal_element_ref(begin_, value) ? std::addressof(value) - tgp::to_address(begin_) : -1;
+            if (count > capacity())
+                reserve(recommend_cap(count));
+            construct_at_end(policy, count - cur_size, offset < 0 ? value : begin_[offset]);
+        }
+    }
+
     TGP_CONSTEXPR_SINCE_CXX20 void swap(vector& other)
     noexcept(alloc_traits::propagate_on_container_swap::value ||
              alloc_traits::is_always_equal::value) {
@@ -473,7 +760,7 @@ public:
 
 
     /* begin of miscellaneous */
-    TGP_CONSTEXPR_SINCE_CXX20 allocator_type get_allocator() noexcept {
+    TGP_CONSTEXPR_SINCE_CXX20 allocator_type get_allocator() const noexcept {
         return alloc_;
     }
 
@@ -494,6 +781,7 @@ public:
     TGP_NOEXCEPT_CONDITIONALLY_SINCE_CXX17(alloc_traits::propagate_on_container_move_assignment::value ||
                              alloc_traits::is_always_equal::value) {
         if (alloc_ == other.alloc_ || alloc_traits::propagate_on_container_move_assignment::value) {
+            deallocate_vector();
             alloc_ = std::move(other.alloc_);
             begin_ = other.begin_;
             end_   = other.end_;
@@ -526,87 +814,301 @@ public:
         }
     }
 
-    template<class InputIt, enable_if_t<std::__has_exactly_input_iterator_category<InputIt>::value, int> = 0>
+    template<class InputIt, enable_if_t<has_exactly_input_iterator_category<InputIt>::value, int> = 0>
     TGP_CONSTEXPR_SINCE_CXX20 void assign(InputIt first, InputIt last) {
-        pointer cur = begin_;
-        for (; cur != end_ && first != last; ++first, (void)++cur)
-            *cur = *first;
-        if (cur == end_) {
-            for (; first != last; ++first)
-                emplace_back(*first);
-        } else {
-            destruct_at_end(cur);
-        }
+        assign_single_pass(std::move(first), std::move(last));
     }
 
-    template<class InputIt, enable_if_t<std::__has_forward_iterator_category<InputIt>::value, int> = 0>
+    template<class InputIt, enable_if_t<has_forward_iterator_category<InputIt>::value, int> = 0>
     TGP_CONSTEXPR_SINCE_CXX20 void assign(InputIt first, InputIt last) {
-        auto count = static_cast<size_type>(std::distance(first, last));
-        if (count > capacity()) {
-            deallocate_vector();
-            allocate_vector(recommend_cap(count));
-            construct_at_end(first, last);
-        } else {
-            const size_type cur_size = size();
-            if (count > cur_size) {
-                InputIt mid = first + count;
-                std::copy(first, mid, begin_);
-                construct_at_end(mid, last);
-            } else {
-                std::copy(first, last, begin_);
-                destruct_at_end(begin_ + count);
-            }
-        }
+        assign_with_size(first, last, static_cast<size_type>(std::distance(first, last)));
+    }
+
+    // replaces the elements by ones constructed from several threads into a fresh buffer, which first-touches
+    // its pages the way the elements are split. the old elements stay if a chunk throws, until then the
+    // vector holds both buffers
+    void assign(const parallel_policy& policy, const size_type count, const value_type& value) {
+        assign_fresh(count, [&policy, &value](vector& v, const size_type n) {
+            v.construct_at_end(policy, n, value);
+        });
+    }
+
+    template<class ForwardIt, enable_if_t<has_forward_iterator_category<ForwardIt>::value, int> = 0>
+    void assign(const parallel_policy& policy, ForwardIt first, ForwardIt last) {
+        assign_fresh(static_cast<size_type>(std::distance(first, last)),
+                     [&policy, &first](vector& v, const size_type n) {
+            v.construct_at_end(policy, first, n);
+        });
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 void assign(std::initializer_list<value_type> ilist) {
         assign(ilist.begin(), ilist.end());
     }
+
+#if TGP_STD_VER >= 20
+    template<container_compatible_range<T> R>
+    constexpr void assign_range(R&& rg) {
+        if constexpr (std::ranges::forward_range<R>) {
+            const auto [first, last, count] = forward_range_bounds(rg);
+            assign_with_size(first, last, count);
+        } else if constexpr (std::ranges::sized_range<R>) {
+            assign_single_pass(std::ranges::begin(rg), std::ranges::end(rg),
+                               static_cast<size_type>(std::ranges::size(rg)));
+        } else {
+            assign_single_pass(std::ranges::begin(rg), std::ranges::end(rg));
+        }
+    }
+#endif
     /* end of miscellaneous */
 
+
+#ifdef TGP_ENABLE_STATS
+    /* begin of statistics */
+    // counts this vector under the tag too, see tgp/stats.h
+    void set_stats_tag(const std::string_view tag) {
+        stats_.set_tag(tag);
+    }
+
+    TGP_NODISCARD stats_counters stats() const noexcept {
+        return stats_.counters((capacity() - size()) * sizeof(value_type));
+    }
+    /* end of statistics */
+#endif
+
 private:
+    // small_vector hands heap buffers over between instances
+    template<class, size_t, class> friend class small_vector;
+
     /* begin of private data members and alias members */
     using alloc_traits = std::allocator_traits<allocator_type>;
 
+    static constexpr bool trivially_relocatable = is_trivially_allocator_relocatable_v<allocator_type, value_type>;
+
+    // the buffer may grow through the allocator's reallocate, which moves the elements' bytes
+    static constexpr bool reallocatable = trivially_relocatable && allocator_has_reallocate_v<allocator_type>;
+
+    // elements may be written through a raw pointer and dropped without being destroyed
+    static constexpr bool overwritable = is_implicit_lifetime_v<value_type> &&
+                                         std::is_trivially_destructible_v<value_type> &&
+                                         allocator_has_trivial_destroy_v<allocator_type, value_type>;
+
     pointer begin_ = nullptr;
     pointer end_   = nullptr;
-    _LIBCPP_COMPRESSED_PAIR(pointer, cap_ = nullptr, allocator_type, alloc_);
+    TGP_COMPRESSED_PAIR(pointer, cap_ = nullptr, allocator_type, alloc_);
+    TGP_STATS_ONLY(container_stats stats_;)
     /* end of private data members and alias members */
 
 
     /* begin of private function members */
     TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(const size_type n) {
-        for (size_type i = 0; i < n; ++i) {
-            alloc_traits::construct(alloc_, std::__to_address(end_));
-            ++end_;
-        }
+        uninitialized_allocator_value_construct_n(alloc_, tgp::to_address(end_), n);
+        end_ += n;
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(const size_type n, default_init_t) {
+        uninitialized_allocator_default_construct_n(alloc_, tgp::to_address(end_), n);
+        end_ += n;
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(const size_type n, const value_type& value) {
-        for (size_type i = 0; i < n; ++i) {
-            alloc_traits::construct(alloc_, std::__to_address(end_), value);
-            ++end_;
-        }
+        uninitialized_allocator_fill_n(alloc_, tgp::to_address(end_), n, value);
+        end_ += n;
     }
 
     template<class Iter>
     TGP_CONSTEXPR_SINCE_CXX20 void construct_at_end(Iter first, Iter last) {
-        for (; first != last; ++first) {
-            ::new (static_cast<void*>(std::__to_address(end_))) value_type(*first);
-            ++end_;
+        value_type* e = tgp::to_address(end_);
+        end_ += (uninitialized_allocator_copy(alloc_, first, last, e) - e);
+    }
+
+#if TGP_STD_VER >= 20
+    /*
+     * the bounds and the size of a forward range, walking it only when it is not sized. a contiguous range is
+     * passed on as pointers, for which trivially copyable elements are copied by memcpy.
+     */
+    template<class R>
+    TGP_NODISCARD static constexpr auto forward_range_bounds(R& rg) {
+        const auto count = static_cast<size_type>(std::ranges::distance(rg));
+        if constexpr (std::ranges::contiguous_range<R>) {
+            const auto first = std::ranges::data(rg);
+            return std::tuple(first, first + count, count);
+        } else if constexpr (std::ranges::common_range<R>) {
+            return std::tuple(std::ranges::begin(rg), std::ranges::end(rg), count);
+        } else {
+            const auto first = std::ranges::begin(rg);
+            return std::tuple(first, std::ranges::next(first, count), count);
+        }
+    }
+#endif
+
+    TGP_CONSTEXPR_SINCE_CXX20 void reserve_for_append(const size_type count) {
+        if (count > static_cast<size_type>(cap_ - end_)) {
+            if (count > max_size() - size())
+                TGP_TRY_THROW(std::length_error("tgp::vector::append_range demanding size exceeds max size"));
+            reserve(recommend_cap(size() + count));
+        }
+    }
+
+    // inserts count elements from [first, last), which may be a range of c++20 iterators
+    template<class ForwardIt>
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert_with_size(const_iterator pos, ForwardIt first, ForwardIt last,
+                                                        size_type count) {
+        const size_type n = pos - begin();
+        pointer p = begin_ + n;
+        if (count + size() > capacity()) {
+            split_buffer<value_type, allocator_type&> sb(recommend_cap(count + size()), n, alloc_);
+            sb.construct_at_end(first, last);
+            p = swap_with_split_buffer(sb, p);
+        } else if (p == end_) {
+            construct_at_end(first, last);
+        } else if constexpr (trivially_relocatable) {
+            move_range(p, end_, p + count);
+            TGP_TRY {
+                uninitialized_allocator_copy(alloc_, first, last, tgp::to_address(p));
+            } TGP_CATCH (...) {
+                close_gap(p, count);
+                TGP_THROW;
+            }
+        } else {
+            auto m = static_cast<size_type>(end() - pos);
+            const size_type old_count = count;
+            ForwardIt mid = last;
+            if (count > m) {
+                mid = std::next(first, m);
+                construct_at_end(mid, last);
+                count = m;
+            }
+            if (count > 0) {
+                move_range(p, p + m, p + old_count);
+                std::copy(first, mid, p);
+            }
+        }
+        return p;
+    }
+
+    /*
+     * a single-pass range is read into a side buffer first, so that the tail moves once instead of being rotated
+     * past the new elements. count is the size of a sized range, both buffers are grown once for it
+     */
+    template<class InputIt, class Sentinel>
+    TGP_CONSTEXPR_SINCE_CXX20 iterator insert_single_pass(const_iterator pos, InputIt first, Sentinel last,
+                                                          const size_type count = 0) {
+        const difference_type n = pos - begin();
+        reserve_for_append(count);
+        if (n == static_cast<difference_type>(size())) {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        } else {
+            vector<value_type, allocator_type> buffer(alloc_);
+            buffer.reserve(count);
+            for (; first != last; ++first)
+                buffer.emplace_back(*first);
+            insert_with_size(begin() + n, std::make_move_iterator(buffer.begin()),
+                             std::make_move_iterator(buffer.end()), buffer.size());
+        }
+        return begin() + n;
+    }
+
+    template<class ForwardIt>
+    TGP_CONSTEXPR_SINCE_CXX20 void assign_with_size(ForwardIt first, ForwardIt last, const size_type count) {
+        if (count > capacity()) {
+            const size_type new_cap = recommend_cap(count);
+            deallocate_vector();
+            allocate_vector(new_cap);
+            construct_at_end(first, last);
+        } else {
+            const size_type cur_size = size();
+            if (count > cur_size) {
+                ForwardIt mid = std::next(first, cur_size);
+                std::copy(first, mid, begin_);
+                construct_at_end(mid, last);
+            } else {
+                std::copy(first, last, begin_);
+                destruct_at_end(begin_ + count);
+            }
+        }
+    }
+
+    // count is the size of a sized range, a buffer too small for it is replaced before any element is assigned
+    template<class InputIt, class Sentinel>
+    TGP_CONSTEXPR_SINCE_CXX20 void assign_single_pass(InputIt first, Sentinel last, const size_type count = 0) {
+        if (count > capacity()) {
+            deallocate_vector();
+            allocate_vector(recommend_cap(count));
+        }
+        pointer cur = begin_;
+        for (; cur != end_ && first != last; ++first, (void)++cur)
+            *cur = *first;
+        if (cur == end_) {
+            for (; first != last; ++first)
+                emplace_back(*first);
+        } else {
+            destruct_at_end(cur);
         }
     }
 
+    void construct_at_end(const parallel_policy& policy, const size_type n) {
+        parallel_uninitialized_construct(policy, alloc_, tgp::to_address(end_), n,
+                                         [this](value_type* p, const size_type m) {
+            uninitialized_allocator_value_construct_n(alloc_, p, m);
+        });
+        end_ += n;
+    }
+
+    void construct_at_end(const parallel_policy& policy, const size_type n, const value_type& value) {
+        parallel_uninitialized_construct(policy, alloc_, tgp::to_address(end_), n,
+                                         [this, &value](value_type* p, const size_type m) {
+            uninitialized_allocator_fill_n(alloc_, p, m, value);
+        });
+        end_ += n;
+    }
+
+    template<class ForwardIt>
+    void construct_at_end(const parallel_policy& policy, ForwardIt first, const size_type n) {
+        value_type* const e = tgp::to_address(end_);
+        parallel_uninitialized_construct(policy, alloc_, e, n, [this, e, &first](value_type* p, const size_type m) {
+            const ForwardIt chunk_first = std::next(first, p - e);
+            uninitialized_allocator_copy(alloc_, chunk_first, std::next(chunk_first, m), p);
+        });
+        end_ += n;
+    }
+
+    // builds count elements into a fresh buffer with construct(v, count) and takes it over. the buffers are
+    // allocated and released on behalf of this vector, so that its stats count them rather than the temporary's
+    template<class Construct>
+    void assign_fresh(const size_type count, Construct construct) {
+        vector fresh(alloc_);
+        if (count > 0) {
+            if (count > max_size())
+                TGP_TRY_THROW(std::length_error("tgp::vector::assign demanding size exceeds max size"));
+            auto allocation = tgp::allocate_at_least(alloc_, count);
+            fresh.begin_ = allocation.ptr;
+            fresh.end_   = fresh.begin_;
+            fresh.cap_   = fresh.begin_ + allocation.count;
+            construct(fresh, count);
+        }
+        deallocate_vector();
+        // the allocators compare equal, only the buffers change hands
+        using std::swap;
+        swap(begin_, fresh.begin_);
+        swap(end_, fresh.end_);
+        swap(cap_, fresh.cap_);
+        TGP_STATS_ONLY(if (begin_) stats_on_allocation();)
+    }
+
     template<class... Args>
     TGP_CONSTEXPR_SINCE_CXX20 void construct_one_at_end(Args&&... args) {
-        alloc_traits::construct(alloc_, std::__to_address(end_), std::forward<Args>(args)...);
+        alloc_traits::construct(alloc_, tgp::to_address(end_), std::forward<Args>(args)...);
         ++end_;
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 void destruct_at_end(pointer new_end) noexcept {
-        pointer soon_to_be_end = end_;
-        while (soon_to_be_end != new_end) {
-            alloc_traits::destroy(alloc_, std::__to_address(--soon_to_be_end));
+        if constexpr (!allocator_has_trivial_destroy_v<allocator_type, value_type> ||
+                      !std::is_trivially_destructible_v<value_type>) {
+            pointer soon_to_be_end = end_;
+            while (soon_to_be_end != new_end) {
+                alloc_traits::destroy(alloc_, tgp::to_address(--soon_to_be_end));
+            }
         }
         end_ = new_end;
     }
@@ -616,45 +1118,68 @@ private:
         if (new_size > ms) {
             TGP_TRY_THROW(std::length_error("tgp::vector::recommend_cap demanding size exceeds max size"));
         }
-        const size_type cur_cap = capacity();
-        if (cur_cap > ms / 2)
-            return ms;
-        return std::max(cur_cap * 2, new_size);
+        const size_type cap = growth_policy::recommend(capacity(), new_size, ms, sizeof(value_type));
+        TGP_POSTCONDITION(new_size <= cap && cap <= ms);
+        return cap;
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 void swap_with_split_buffer(split_buffer<value_type, allocator_type&>& sb) {
-        std::__uninitialized_allocator_relocate(
-            alloc_, std::__to_address(begin_), std::__to_address(end_), std::__to_address(sb.first_));
+        TGP_STATS_ONLY(stats_on_swap(sb);)
+        pointer new_begin = sb.begin_ - (end_ - begin_);
+        uninitialized_allocator_relocate(
+            alloc_, tgp::to_address(begin_), tgp::to_address(end_), tgp::to_address(new_begin));
+        sb.begin_ = new_begin;
         end_ = begin_;
         std::swap(begin_, sb.begin_);
         std::swap(end_, sb.end_);
         std::swap(cap_, sb.cap_);
+        sb.first_ = sb.begin_;
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 pointer swap_with_split_buffer(split_buffer<value_type, allocator_type&>& sb, pointer p) {
+        TGP_STATS_ONLY(stats_on_swap(sb);)
         pointer ret = sb.begin_;
-        std::__uninitialized_allocator_relocate(
-            alloc_, std::__to_address(p), std::__to_address(end_), std::__to_address(sb.end_));
+        uninitialized_allocator_relocate(
+            alloc_, tgp::to_address(p), tgp::to_address(end_), tgp::to_address(sb.end_));
         sb.end_ += (end_ - p);
         end_ = p;
 
-        std::__uninitialized_allocator_relocate(
-            alloc_, std::__to_address(begin_), std::__to_address(p), std::__to_address(sb.first_));
-        sb.begin_ -= (p - begin_);
+        pointer new_begin = sb.begin_ - (p - begin_);
+        uninitialized_allocator_relocate(
+            alloc_, tgp::to_address(begin_), tgp::to_address(p), tgp::to_address(new_begin));
+        sb.begin_ = new_begin;
         end_ = begin_;
 
         std::swap(begin_, sb.begin_);
         std::swap(end_, sb.end_);
         std::swap(cap_, sb.cap_);
+        sb.first_ = sb.begin_;
         return ret;
     }
 
+    /*
+     * moves [from_s, from_e) to [to, to + (from_e - from_s)) and extends end_ accordingly.
+     * trivially relocatable elements are memmoved and leave [from_s, to) uninitialized, which requires from_e == end_.
+     * the others leave moved-from elements in [from_s, to).
+     */
     TGP_CONSTEXPR_SINCE_CXX20 void move_range(pointer from_s, pointer from_e, pointer to) {
-        pointer old_last = end_;
-        difference_type n = old_last - to;
-        for (pointer p = from_s + n; p < from_e; ++p)
-            construct_one_at_end(std::move(*p));
-        std::move_backward(from_s, from_s + n, old_last);
+        if constexpr (trivially_relocatable) {
+            allocator_trivially_relocate(
+                alloc_, tgp::to_address(from_s), tgp::to_address(from_e), tgp::to_address(to));
+            end_ += (to - from_s);
+        } else {
+            pointer old_last = end_;
+            difference_type n = old_last - to;
+            for (pointer p = from_s + n; p < from_e; ++p)
+                construct_one_at_end(std::move(*p));
+            std::move_backward(from_s, from_s + n, old_last);
+        }
+    }
+
+    // undoes move_range(p, end_, p + n) for trivially relocatable elements
+    TGP_CONSTEXPR_SINCE_CXX20 void close_gap(pointer p, const size_type n) noexcept {
+        allocator_trivially_relocate(alloc_, tgp::to_address(p + n), tgp::to_address(end_), tgp::to_address(p));
+        end_ -= n;
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 bool invariants() const {
@@ -672,6 +1197,7 @@ private:
 
     TGP_CONSTEXPR_SINCE_CXX20 void destroy_vector() noexcept {
         if (begin_) {
+            TGP_STATS_ONLY(stats_on_release();)
             clear();
             alloc_traits::deallocate(alloc_, begin_, capacity());
         }
@@ -680,13 +1206,47 @@ private:
     TGP_CONSTEXPR_SINCE_CXX20 void allocate_vector(const size_type n) {
         if (n > max_size())
             TGP_TRY_THROW(std::length_error("tgp::vector::allocator_vector demanding size exceeds max size"));
-        begin_ = alloc_traits::allocate(alloc_, n);
+        auto allocation = tgp::allocate_at_least(alloc_, n);
+        begin_ = allocation.ptr;
         end_   = begin_;
-        cap_   = begin_ + n;
+        cap_   = begin_ + allocation.count;
+        TGP_STATS_ONLY(stats_on_allocation();)
+    }
+
+    // grows the buffer to hold at least new_cap elements without moving it, if the allocator can
+    TGP_CONSTEXPR_SINCE_CXX20 bool expand_in_place(const size_type new_cap) {
+        if constexpr (allocator_has_expand_in_place_v<allocator_type>) {
+            if (begin_ != nullptr && !TGP_IS_CONSTANT_EVALUATED()) {
+                if (const size_type n = alloc_.expand_in_place(begin_, capacity(), new_cap)) {
+                    cap_ = begin_ + n;
+                    TGP_STATS_ONLY(stats_on_allocation();)
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // grows the buffer to hold at least new_cap elements through the allocator's reallocate
+    TGP_CONSTEXPR_SINCE_CXX20 void reallocate_vector(const size_type new_cap) {
+        static_assert(reallocatable);
+        if (begin_ == nullptr) {
+            allocate_vector(new_cap);
+        } else {
+            const size_type cur_size = size();
+            TGP_STATS_ONLY(stats_on_release();)
+            auto allocation = alloc_.reallocate(begin_, capacity(), new_cap);
+            TGP_STATS_ONLY(if (allocation.ptr != begin_) stats_on_relocation(cur_size);)
+            begin_ = allocation.ptr;
+            end_   = begin_ + cur_size;
+            cap_   = begin_ + allocation.count;
+            TGP_STATS_ONLY(stats_on_allocation();)
+        }
     }
 
     TGP_CONSTEXPR_SINCE_CXX20 void deallocate_vector() {
         if (begin_) {
+            TGP_STATS_ONLY(stats_on_release();)
             clear();
             alloc_traits::deallocate(alloc_, begin_, capacity());
             begin_ = end_ = cap_ = nullptr;
@@ -694,19 +1254,70 @@ private:
     }
 
     TGP_NODISCARD TGP_CONSTEXPR_SINCE_CXX20 bool is_internal_element_ref(const_iterator begin, const value_type& value) {
-        return std::addressof(value) >= std::__to_address(begin) &&
-               std::addressof(value) < std::__to_address(end_);
+        return std::addressof(value) >= tgp::to_address(begin) &&
+               std::addressof(value) < tgp::to_address(end_);
     }
+
+#ifdef TGP_ENABLE_STATS
+    // the hooks only count at run time, the registry is no constant expression
+    TGP_CONSTEXPR_SINCE_CXX20 void stats_on_allocation() noexcept {
+        if (!TGP_IS_CONSTANT_EVALUATED())
+            stats_.on_allocation(capacity() * sizeof(value_type));
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void stats_on_relocation(const size_type n) noexcept {
+        if (!TGP_IS_CONSTANT_EVALUATED() && n != 0)
+            stats_.on_relocation(n, n * sizeof(value_type));
+    }
+
+    TGP_CONSTEXPR_SINCE_CXX20 void stats_on_release() noexcept {
+        if (!TGP_IS_CONSTANT_EVALUATED())
+            stats_.on_release((capacity() - size()) * sizeof(value_type));
+    }
+
+    // the elements move into sb, which has been allocated, and sb takes over the current buffer
+    TGP_CONSTEXPR_SINCE_CXX20 void stats_on_swap(const split_buffer<value_type, allocator_type&>& sb) noexcept {
+        if (!TGP_IS_CONSTANT_EVALUATED()) {
+            stats_.on_allocation(sb.capacity() * sizeof(value_type));
+            if (begin_) {
+                stats_on_relocation(size());
+                stats_on_release();
+            }
+        }
+    }
+#endif
     /* end of private function members */
 
 }; // end of class vector
 
+#if TGP_STD_VER >= 20
+template<std::ranges::input_range R, class Alloc = std::allocator<std::ranges::range_value_t<R>>>
+vector(from_range_t, R&&, Alloc = Alloc()) -> vector<std::ranges::range_value_t<R>, Alloc>;
+#endif
+
+// removes every element equal to value in one pass, returns how many were removed
+template<class T, class Alloc, class GrowthPolicy, class U>
+TGP_CONSTEXPR_SINCE_CXX20 typename vector<T, Alloc, GrowthPolicy>::size_type
+erase(vector<T, Alloc, GrowthPolicy>& c, const U& value) {
+    const auto old_size = c.size();
+    c.erase(std::remove(c.begin(), c.end(), value), c.end());
+    return old_size - c.size();
+}
+
+template<class T, class Alloc, class GrowthPolicy, class Pred>
+TGP_CONSTEXPR_SINCE_CXX20 typename vector<T, Alloc, GrowthPolicy>::size_type
+erase_if(vector<T, Alloc, GrowthPolicy>& c, Pred pred) {
+    const auto old_size = c.size();
+    c.erase(std::remove_if(c.begin(), c.end(), pred), c.end());
+    return old_size - c.size();
+}
+
 NAMESPACE_TGP_END
 
 namespace std {
 
-template<class T, class Alloc>
-void swap(tgp::vector<T, Alloc>& lhs, tgp::vector<T, Alloc>& rhs)
+template<class T, class Alloc, class GrowthPolicy>
+void swap(tgp::vector<T, Alloc, GrowthPolicy>& lhs, tgp::vector<T, Alloc, GrowthPolicy>& rhs)
 TGP_NOEXCEPT_CONDITIONALLY_SINCE_CXX17(noexcept(lhs.swap(rhs))) {
     lhs.swap(rhs);
 }
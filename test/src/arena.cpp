@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <tgp/arena.h>
+#include <tgp/vector.h>
+
+using namespace tgp;
+
+namespace {
+
+template<class T>
+using arena_vector = vector<T, arena_allocator<T>>;
+
+bool is_aligned(const void* p, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+template<class T>
+T make(int i) {
+    if constexpr (std::is_same_v<T, std::string>)
+        return std::string(32, static_cast<char>('a' + i % 26));
+    else
+        return T(i);
+}
+
+void test_bump_and_rollback(testing::Test*) {
+    arena a(256);
+    void* p = a.allocate(3, 1);
+    void* q = a.allocate(8, 8);
+    void* r = a.allocate(64, 64);
+    EXPECT_TRUE(is_aligned(q, 8));
+    EXPECT_TRUE(is_aligned(r, 64));
+    EXPECT_LT(p, q);
+
+    a.deallocate(r, 64);
+    EXPECT_EQ(a.allocate(64, 64), r);
+    // not the most recent allocation, nothing to give back
+    a.deallocate(q, 8);
+    EXPECT_NE(a.allocate(8, 8), q);
+
+    // larger than a block, chains a new one
+    void* big = a.allocate(1000, 16);
+    EXPECT_TRUE(is_aligned(big, 16));
+    EXPECT_GE(a.capacity(), 1256u);
+
+    a.reset();
+    const std::size_t kept = a.capacity();
+    EXPECT_GE(kept, 1000u);
+    EXPECT_LT(kept, 1256u);
+    EXPECT_NE(a.allocate(500, 8), nullptr);
+    EXPECT_EQ(a.capacity(), kept);
+}
+
+template<class T>
+void test_vector_in_arena(testing::Test*) {
+    arena a(1 << 16);
+    arena_vector<T> v(a);
+    v.reserve(4);
+    const T* data = v.data();
+    for (int i = 0; i < 1000; ++i)
+        v.push_back(make<T>(i));
+    // the vector sits at the top of the arena, so it grows in place
+    EXPECT_EQ(v.data(), data);
+
+    arena_vector<T> w(a);
+    for (int i = 0; i < 100; ++i)
+        w.push_back(make<T>(i));
+    v.resize(2000, make<T>(7));
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(v[i], make<T>(i));
+    for (int i = 0; i < 100; ++i)
+        ASSERT_EQ(w[i], make<T>(i));
+}
+
+template<class T>
+void test_propagation(testing::Test*) {
+    arena a, b;
+    arena_vector<T> v(a), w(b);
+    for (int i = 0; i < 10; ++i)
+        v.push_back(make<T>(i));
+    w.push_back(make<T>(42));
+
+    // moving takes the arena along, the buffer is not copied
+    const T* data = v.data();
+    w = std::move(v);
+    EXPECT_EQ(w.data(), data);
+    EXPECT_EQ(&w.get_allocator().resource(), &a);
+
+    arena_vector<T> u(b);
+    u.push_back(make<T>(1));
+    u.swap(w);
+    EXPECT_EQ(u.data(), data);
+    EXPECT_EQ(&u.get_allocator().resource(), &a);
+    EXPECT_EQ(&w.get_allocator().resource(), &b);
+
+    // copying keeps the arena of the target
+    w = u;
+    EXPECT_EQ(&w.get_allocator().resource(), &b);
+    ASSERT_EQ(w.size(), 10u);
+    EXPECT_EQ(w[9], make<T>(9));
+}
+
+} // end of unnamed namespace
+
+TEST(arena, bump_and_rollback) {
+    test_bump_and_rollback(this);
+}
+
+TEST(arena, vector_in_arena) {
+    test_vector_in_arena<int>(this);
+    test_vector_in_arena<std::string>(this);
+}
+
+TEST(arena, propagation) {
+    test_propagation<int>(this);
+    test_propagation<std::string>(this);
+}
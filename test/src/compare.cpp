@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <string>
+
+#include <tgp/compare.h>
+#include <tgp/vector.h>
+
+using namespace tgp;
+
+namespace {
+
+// compares every pair of prefixes of a and b against the standard algorithms, with mismatches at every position
+template<class T>
+void test_integral_kernels(testing::Test*) {
+    vector<T> a, b;
+    for (int i = 0; i < 80; ++i) {
+        a.push_back(static_cast<T>(i * 37 - 500));
+        b.push_back(static_cast<T>(i * 37 - 500));
+    }
+    auto check = [](const vector<T>& lhs, const vector<T>& rhs) {
+        const bool equal = std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        const bool less  = std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        const bool greater = std::lexicographical_compare(rhs.begin(), rhs.end(), lhs.begin(), lhs.end());
+        ASSERT_EQ(lhs == rhs, equal);
+        ASSERT_EQ(lhs != rhs, !equal);
+        ASSERT_EQ(lhs < rhs, less);
+        ASSERT_EQ(lhs > rhs, greater);
+        ASSERT_EQ(lhs <= rhs, !greater);
+        ASSERT_EQ(lhs >= rhs, !less);
+        ASSERT_EQ(lhs <=> rhs, less ? std::strong_ordering::less
+                                    : greater ? std::strong_ordering::greater : std::strong_ordering::equal);
+    };
+    for (std::size_t n = 0; n <= a.size(); ++n) {
+        vector<T> x(a.begin(), a.begin() + n);
+        vector<T> y(b.begin(), b.begin() + n);
+        check(x, y);
+        for (std::size_t i = 0; i < n; ++i) {
+            // a difference in the high byte only, and one flipping the sign
+            y[i] = static_cast<T>(x[i] ^ (T(1) << (sizeof(T) * 8 - 1)));
+            check(x, y);
+            check(y, x);
+            y[i] = static_cast<T>(x[i] + 1);
+            check(x, y);
+            check(y, x);
+            y[i] = x[i];
+        }
+        vector<T> longer(x);
+        longer.push_back(T(0));
+        check(x, longer);
+        check(longer, x);
+    }
+}
+
+// every kernel, whichever one the cpu dispatch picks
+void test_mismatch_kernels(testing::Test*) {
+    unsigned char a[100] = {}, b[100] = {};
+    for (std::size_t n = 0; n <= sizeof(a); ++n) {
+        for (std::size_t i = 0; i <= n; ++i) {
+            if (i < n)
+                b[i] = 1;
+            ASSERT_EQ(mismatch_bytes_scalar(a, b, n), i);
+            ASSERT_EQ(mismatch_bytes(a, b, n), i);
+#ifdef TGP_HAS_X86_DISPATCH
+            ASSERT_EQ(mismatch_bytes_sse2(a, b, n), i);
+            if (__builtin_cpu_supports("avx2")) {
+                ASSERT_EQ(mismatch_bytes_avx2(a, b, n), i);
+            }
+#endif
+            if (i < n)
+                b[i] = 0;
+        }
+    }
+}
+
+void test_generic_ranges(testing::Test*) {
+    // elements with only operator<
+    struct key {
+        int value;
+        bool operator<(const key& other) const { return value < other.value; }
+        bool operator==(const key& other) const { return value == other.value; }
+    };
+    const vector<key> a{{1}, {2}, {3}};
+    const vector<key> b{{1}, {2}, {4}};
+    ASSERT_TRUE(a < b);
+    ASSERT_TRUE(b >= a);
+    ASSERT_EQ(a <=> b, std::weak_ordering::less);
+
+    const vector<std::string> c{"a", "b"};
+    const vector<std::string> d{"a", "b", ""};
+    ASSERT_TRUE(c < d);
+    ASSERT_TRUE(c != d);
+    ASSERT_EQ(c <=> c, std::strong_ordering::equal);
+
+    const vector<double> e{1.0, 2.0};
+    const vector<double> f{1.0, 3.0};
+    ASSERT_EQ(e <=> f, std::partial_ordering::less);
+}
+
+} // end of unnamed namespace
+
+TEST(compare, integral_kernels) {
+    test_integral_kernels<unsigned char>(this);
+    test_integral_kernels<signed char>(this);
+    test_integral_kernels<char>(this);
+    test_integral_kernels<std::int16_t>(this);
+    test_integral_kernels<std::uint16_t>(this);
+    test_integral_kernels<std::int32_t>(this);
+    test_integral_kernels<std::uint32_t>(this);
+    test_integral_kernels<std::int64_t>(this);
+    test_integral_kernels<std::uint64_t>(this);
+}
+
+TEST(compare, mismatch_kernels) {
+    test_mismatch_kernels(this);
+}
+
+TEST(compare, generic_ranges) {
+    test_generic_ranges(this);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tgp/concurrent_vector.h>
+
+#include "test_types.h"
+
+using namespace tgp;
+
+namespace {
+
+// throws bad_alloc while fail is set
+template<class T>
+struct failing_allocator : std::allocator<T> {
+    using value_type = T;
+
+    template<class U>
+    struct rebind { using other = failing_allocator<U>; };
+
+    static inline bool fail = false;
+
+    failing_allocator() = default;
+
+    template<class U>
+    failing_allocator(const failing_allocator<U>&) noexcept {}
+
+    T* allocate(const std::size_t n) {
+        if (failing_allocator<int>::fail)
+            throw std::bad_alloc();
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+void test_stable_addresses(testing::Test*) {
+    concurrent_vector<std::string> c;
+    std::string& first = c.emplace_back("first");
+    const std::string* address = &first;
+    for (int i = 0; i < 10000; ++i)
+        c.push_back(std::to_string(i));
+    ASSERT_EQ(&c[0], address);
+    ASSERT_EQ(c[0], "first");
+    ASSERT_EQ(c.size(), 10001);
+    ASSERT_EQ(c.at(10000), "9999");
+    ASSERT_THROW(static_cast<void>(c.at(10001)), std::out_of_range);
+
+    const std::size_t pos = c.grow_by(100, "x");
+    ASSERT_EQ(pos, 10001);
+    ASSERT_EQ(std::count(std::next(c.begin(), pos), c.end(), "x"), 100);
+    ASSERT_EQ(std::distance(c.begin(), c.end()), 10101);
+    ASSERT_EQ(*std::next(c.rbegin(), 100), "9999");
+
+    c.clear();
+    ASSERT_TRUE(c.empty());
+    c.reserve(1000);
+    ASSERT_EQ(c[c.grow_by(3)], "");
+}
+
+void test_concurrent_append(testing::Test*) {
+    constexpr std::size_t threads = 8, per_thread = 20000;
+    concurrent_vector<std::size_t> c;
+    std::vector<std::thread> workers;
+    std::atomic<bool> mismatch{false};
+    std::atomic<bool> done{false};
+    // walks the published elements while the others append
+    std::thread reader([&c, &mismatch, &done] {
+        while (!done) {
+            std::size_t n = 0;
+            for (const std::size_t value : c) {
+                if (value >= threads * per_thread)
+                    mismatch = true;
+                ++n;
+            }
+            if (n > c.size())
+                mismatch = true;
+        }
+    });
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&c, &mismatch, t] {
+            for (std::size_t i = 0; i < per_thread; ++i) {
+                const std::size_t value = t * per_thread + i;
+                std::size_t& ref = (i % 2 == 0) ? c.emplace_back(value) : c[c.grow_by(1, value)];
+                if (ref != value)
+                    mismatch = true;
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+    done = true;
+    reader.join();
+    ASSERT_FALSE(mismatch);
+    ASSERT_EQ(c.size(), threads * per_thread);
+    std::vector<std::size_t> values(c.begin(), c.end());
+    std::sort(values.begin(), values.end());
+    for (std::size_t i = 0; i < values.size(); ++i)
+        ASSERT_EQ(values[i], i);
+}
+
+void test_exceptions(testing::Test*) {
+    {
+        concurrent_vector<tracked> c;
+        const tracked value(7);
+        tracked::copies = 0;
+        tracked::throw_at = 5;
+        c.grow_by(3, value);
+        ASSERT_THROW(c.grow_by(4, value), std::runtime_error);
+        ASSERT_EQ(tracked::live, 4);
+        tracked::throw_at = -1;
+        c.push_back(value);
+        ASSERT_EQ(c.size(), 8);
+        ASSERT_EQ(c[7].value, 7);
+
+        // the indices 3 to 6 of the throwing append are skipped
+        ASSERT_EQ(std::distance(c.begin(), c.end()), 4);
+        ASSERT_EQ(std::distance(c.rbegin(), c.rend()), 4);
+        for (const auto& x : c)
+            ASSERT_EQ(x.value, 7);
+        ASSERT_EQ(std::next(c.begin(), 3).index(), 7);
+        ASSERT_EQ(std::prev(c.end(), 2).index(), 2);
+        ASSERT_THROW(static_cast<void>(c.at(4)), std::out_of_range);
+        ASSERT_EQ(c.at(2).value, 7);
+    }
+    ASSERT_EQ(tracked::live, 0);
+
+    {
+        // the segment of index 64 fails to allocate, the next append allocates it
+        concurrent_vector<int, failing_allocator<int>> c;
+        c.grow_by(64, 1);
+        failing_allocator<int>::fail = true;
+        ASSERT_THROW(c.push_back(2), std::bad_alloc);
+        failing_allocator<int>::fail = false;
+        c.push_back(3);
+        ASSERT_EQ(c.size(), 66);
+        ASSERT_EQ(std::count(c.begin(), c.end(), 1), 64);
+        ASSERT_EQ(*std::prev(c.end()), 3);
+        ASSERT_EQ(std::distance(c.begin(), c.end()), 65);
+        ASSERT_THROW(static_cast<void>(c.at(64)), std::out_of_range);
+    }
+}
+
+} // end of unnamed namespace
+
+TEST(concurrent_vector, stable_addresses) {
+    test_stable_addresses(this);
+}
+
+TEST(concurrent_vector, concurrent_append) {
+    test_concurrent_append(this);
+}
+
+TEST(concurrent_vector, exceptions) {
+    test_exceptions(this);
+}
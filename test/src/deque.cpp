@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <tgp/deque.h>
+
+#include "test_types.h"
+
+using namespace tgp;
+
+namespace {
+
+// applies the same random pushes and pops to a tgp::deque and a std::deque
+void test_both_ends(testing::Test*) {
+    deque<int> d;
+    std::deque<int> expected;
+    std::minstd_rand rng{12345};
+    for (int i = 0; i < 200000; ++i) {
+        const auto r = static_cast<std::uint32_t>(rng());
+        switch ((r >> 16) % 5) {
+        case 0:
+        case 1:
+            d.push_back(i);
+            expected.push_back(i);
+            break;
+        case 2:
+            d.emplace_front(i);
+            expected.push_front(i);
+            break;
+        case 3:
+            if (!expected.empty()) {
+                d.pop_back();
+                expected.pop_back();
+            }
+            break;
+        default:
+            if (!expected.empty()) {
+                d.pop_front();
+                expected.pop_front();
+            }
+            break;
+        }
+        ASSERT_EQ(d.size(), expected.size());
+        if (!expected.empty()) {
+            ASSERT_EQ(d.front(), expected.front());
+            ASSERT_EQ(d.back(), expected.back());
+        }
+    }
+    ASSERT_TRUE(d.invariants());
+    ASSERT_TRUE(std::equal(d.begin(), d.end(), expected.begin(), expected.end()));
+    ASSERT_TRUE(std::equal(d.rbegin(), d.rend(), expected.rbegin(), expected.rend()));
+    for (std::size_t i = 0; i < expected.size(); i += 97)
+        ASSERT_EQ(d[i], expected[i]);
+}
+
+void test_stable_references(testing::Test*) {
+    deque<std::string> d;
+    d.push_back("anchor");
+    const std::string* address = &d.front();
+    for (int i = 0; i < 5000; ++i) {
+        d.push_back(std::to_string(i));
+        d.push_front(std::to_string(-i));
+    }
+    ASSERT_EQ(&d[5000], address);
+    ASSERT_EQ(d.at(5000), "anchor");
+    ASSERT_THROW(static_cast<void>(d.at(d.size())), std::out_of_range);
+}
+
+void test_iterator(testing::Test*) {
+    using D = deque<std::uint64_t>;
+    static_assert(std::random_access_iterator<D::iterator>);
+    static_assert(std::random_access_iterator<D::const_iterator>);
+
+    D d;
+    for (std::uint64_t i = 0; i < 3 * D::block_size; ++i)
+        d.push_front(i);
+    const D& cd = d;
+    const auto n = static_cast<std::ptrdiff_t>(d.size());
+    ASSERT_EQ(d.end() - d.begin(), n);
+    ASSERT_EQ(cd.cend() - cd.cbegin(), n);
+    for (std::ptrdiff_t i = 0; i <= n; i += 7) {
+        for (std::ptrdiff_t j = 0; j <= n; j += 13) {
+            ASSERT_EQ((d.begin() + i) + (j - i), d.begin() + j);
+            ASSERT_EQ((d.begin() + i) - (d.begin() + j), i - j);
+            ASSERT_EQ(d.begin() + i < d.begin() + j, i < j);
+        }
+        if (i < n) {
+            ASSERT_EQ(d.begin()[i], d[static_cast<std::size_t>(i)]);
+        }
+    }
+    D::const_iterator it = d.end();
+    for (std::ptrdiff_t i = n; i > 0; --i)
+        --it;
+    ASSERT_EQ(it, cd.begin());
+
+    std::sort(d.begin(), d.end());
+    ASSERT_TRUE(std::is_sorted(cd.begin(), cd.end()));
+    ASSERT_EQ(d.front(), 0);
+}
+
+void test_constructor_and_assignment(testing::Test*) {
+    deque<int> a(1000, 7);
+    ASSERT_EQ(std::count(a.begin(), a.end(), 7), 1000);
+    deque<int> b(1000);
+    ASSERT_EQ(std::count(b.begin(), b.end(), 0), 1000);
+    deque<int> c{1, 2, 3};
+    ASSERT_EQ(c.size(), 3);
+    ASSERT_EQ(c.back(), 3);
+
+    deque<int> copy(a);
+    ASSERT_TRUE(copy == a);
+    deque<int> moved(std::move(copy));
+    ASSERT_TRUE(moved == a);
+    ASSERT_TRUE(copy.empty());
+    copy.push_back(1);
+    ASSERT_EQ(copy.front(), 1);
+
+    b = c;
+    ASSERT_TRUE(b == c);
+    b = std::move(a);
+    ASSERT_EQ(b.size(), 1000);
+    b = {4, 5};
+    ASSERT_EQ(b.size(), 2);
+    ASSERT_TRUE(c < b);
+
+    b.resize(600, 9);
+    ASSERT_EQ(b[599], 9);
+    b.resize(1);
+    ASSERT_EQ(b.size(), 1);
+    b.assign(3000, 2);
+    ASSERT_EQ(std::accumulate(b.begin(), b.end(), 0), 6000);
+    b.swap(c);
+    ASSERT_EQ(b.size(), 3);
+    ASSERT_EQ(c.size(), 3000);
+
+    c.clear();
+    ASSERT_TRUE(c.empty());
+    ASSERT_TRUE(c.invariants());
+    c.push_front(1);
+    c.push_back(2);
+    ASSERT_EQ(c.front(), 1);
+    ASSERT_EQ(c.back(), 2);
+    c.shrink_to_fit();
+    ASSERT_TRUE(c.invariants());
+}
+
+void test_exception_safety(testing::Test*) {
+    tracked::live = 0;
+    {
+        deque<tracked> d;
+        for (int i = 0; i < 1000; ++i)
+            d.emplace_back(i);
+        tracked::copies   = 0;
+        tracked::throw_at = 0;
+        ASSERT_THROW(d.push_front(d.back()), std::runtime_error);
+        tracked::copies = 0;
+        ASSERT_THROW(d.push_back(d.front()), std::runtime_error);
+        ASSERT_EQ(d.size(), 1000);
+        ASSERT_EQ(tracked::live, 1000);
+
+        tracked::copies   = 0;
+        tracked::throw_at = 500;
+        ASSERT_THROW(deque<tracked> copy(d), std::runtime_error);
+        ASSERT_EQ(tracked::live, 1000);
+        tracked::throw_at = -1;
+    }
+    ASSERT_EQ(tracked::live, 0);
+}
+
+// popping from the front and pushing at the back keeps reusing the same blocks
+void test_fifo(testing::Test*) {
+    deque<int, counting_allocator<int>> d;
+    for (int i = 0; i < 3000; ++i)
+        d.push_back(i);
+    for (int i = 0; i < 2000; ++i)
+        d.pop_front();
+    counting_allocator<int>::allocations = 0;
+    for (int i = 3000; i < 100000; ++i) {
+        ASSERT_EQ(d.front(), i - 1000);
+        d.pop_front();
+        d.push_back(i);
+    }
+    ASSERT_TRUE(d.invariants());
+    ASSERT_EQ(counting_allocator<int>::allocations, 0);
+}
+
+} // end of unnamed namespace
+
+TEST(deque, both_ends) {
+    test_both_ends(this);
+}
+
+TEST(deque, stable_references) {
+    test_stable_references(this);
+}
+
+TEST(deque, iterator) {
+    test_iterator(this);
+}
+
+TEST(deque, constructor_and_assignment) {
+    test_constructor_and_assignment(this);
+}
+
+TEST(deque, exception_safety) {
+    test_exception_safety(this);
+}
+
+TEST(deque, fifo) {
+    test_fifo(this);
+}
@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <tgp/devector.h>
+
+#include "test_types.h"
+
+using namespace tgp;
+
+namespace {
+
+// applies the same random operations at both ends and in the middle to a devector and a std::deque
+template<class T, class Make>
+void run_random_ops(Make make) {
+    devector<T> d;
+    std::deque<T> expected;
+    std::minstd_rand rng{12345};
+    for (int i = 0; i < 20000; ++i) {
+        const auto r = static_cast<std::uint32_t>(rng());
+        const std::size_t pos = expected.empty() ? 0 : (r >> 8) % (expected.size() + 1);
+        switch ((r >> 20) % 8) {
+        case 0:
+        case 1:
+            d.push_back(make(i));
+            expected.push_back(make(i));
+            break;
+        case 2:
+        case 3:
+            d.emplace_front(make(i));
+            expected.push_front(make(i));
+            break;
+        case 4:
+            d.insert(d.begin() + pos, make(i));
+            expected.insert(expected.begin() + pos, make(i));
+            break;
+        case 5:
+            d.insert(d.begin() + pos, 3, make(i));
+            expected.insert(expected.begin() + pos, 3, make(i));
+            break;
+        case 6:
+            if (!expected.empty()) {
+                const std::size_t n = std::min<std::size_t>(2, expected.size() - std::min(pos, expected.size() - 1));
+                const std::size_t p = std::min(pos, expected.size() - n);
+                d.erase(d.begin() + p, d.begin() + p + n);
+                expected.erase(expected.begin() + p, expected.begin() + p + n);
+            }
+            break;
+        default:
+            if (!expected.empty()) {
+                if (r & 1) {
+                    d.pop_front();
+                    expected.pop_front();
+                } else {
+                    d.pop_back();
+                    expected.pop_back();
+                }
+            }
+            break;
+        }
+        ASSERT_EQ(d.size(), expected.size());
+        ASSERT_TRUE(d.invariants());
+    }
+    ASSERT_TRUE(std::equal(d.begin(), d.end(), expected.begin(), expected.end()));
+}
+
+void test_random_ops(testing::Test*) {
+    run_random_ops<int>([](int i) { return i; });
+    run_random_ops<std::string>([](int i) { return std::to_string(i) + std::string(20, 'x'); });
+}
+
+// the elements stay one array that data() hands out
+void test_contiguous(testing::Test*) {
+    devector<int> d;
+    for (int i = 0; i < 1000; ++i) {
+        d.push_front(-1 - i);
+        d.push_back(i);
+    }
+    ASSERT_EQ(d.data(), &d.front());
+    ASSERT_EQ(d.data() + d.size() - 1, &d.back());
+    const int* p = d.data();
+    for (std::size_t i = 0; i < d.size(); ++i)
+        ASSERT_EQ(p[i], static_cast<int>(i) - 1000);
+    ASSERT_EQ(d.at(1000), 0);
+    ASSERT_THROW(static_cast<void>(d.at(d.size())), std::out_of_range);
+}
+
+// pushing at one end and popping at the other recenters in place instead of growing
+void test_capacity(testing::Test*) {
+    devector<int> d;
+    d.reserve_front(100);
+    ASSERT_GE(d.front_free_capacity(), 100);
+    d.reserve_back(200);
+    ASSERT_GE(d.back_free_capacity(), 200);
+    ASSERT_GE(d.front_free_capacity(), 100);
+
+    const std::size_t cap = d.capacity();
+    for (int i = 0; i < 10000; ++i) {
+        d.push_front(i);
+        if (d.size() > 10)
+            d.pop_back();
+    }
+    ASSERT_EQ(d.capacity(), cap);
+    for (int i = 0; i < 10000; ++i) {
+        d.push_back(i);
+        if (d.size() > 10)
+            d.pop_front();
+    }
+    ASSERT_EQ(d.capacity(), cap);
+    ASSERT_EQ(d.back(), 9999);
+
+    d.shrink_to_fit();
+    ASSERT_EQ(d.capacity(), d.size());
+    ASSERT_TRUE(d.invariants());
+    d.clear();
+    d.shrink_to_fit();
+    ASSERT_EQ(d.capacity(), 0);
+    ASSERT_TRUE(d.invariants());
+}
+
+// insert and erase move only the elements on the shorter side
+void test_shift_side(testing::Test*) {
+    devector<int> d;
+    d.reserve_front(64);
+    d.reserve_back(64);
+    for (int i = 0; i < 10; ++i)
+        d.push_back(i);
+    const int* first = &d.front();
+    const int* last  = &d.back();
+
+    d.insert(d.begin() + 2, 100);
+    ASSERT_EQ(&d.back(), last);
+    ASSERT_EQ(&d.front(), first - 1);
+    d.insert(d.end() - 2, 200);
+    ASSERT_EQ(&d.back(), last + 1);
+    ASSERT_EQ(&d.front(), first - 1);
+
+    d.erase(d.begin() + 1);
+    ASSERT_EQ(&d.front(), first);
+    d.erase(d.end() - 3, d.end() - 1);
+    ASSERT_EQ(&d.back(), last - 1);
+    const int expected[] = {0, 100, 2, 3, 4, 5, 6, 7, 9};
+    ASSERT_TRUE(std::equal(d.begin(), d.end(), std::begin(expected), std::end(expected)));
+}
+
+void test_constructor_and_assignment(testing::Test*) {
+    devector<std::string> a(100, "seven");
+    ASSERT_EQ(std::count(a.begin(), a.end(), "seven"), 100);
+    devector<int> b(1000);
+    ASSERT_EQ(std::count(b.begin(), b.end(), 0), 1000);
+    devector<int> c{1, 2, 3};
+    ASSERT_EQ(c.size(), 3);
+    ASSERT_EQ(c.back(), 3);
+
+    devector<std::string> copy(a);
+    ASSERT_TRUE(copy == a);
+    devector<std::string> moved(std::move(copy));
+    ASSERT_TRUE(moved == a);
+    ASSERT_TRUE(copy.empty());
+    copy.push_front("one");
+    ASSERT_EQ(copy.front(), "one");
+
+    b = c;
+    ASSERT_TRUE(b == c);
+    b = {4, 5};
+    ASSERT_EQ(b.size(), 2);
+    ASSERT_TRUE(c < b);
+    b.insert(b.begin() + 1, {7, 8, 9});
+    ASSERT_EQ(b[3], 9);
+    b.insert(b.begin() + 1, b.back());
+    ASSERT_EQ(b[1], 5);
+
+    b.resize(600, b.front());
+    ASSERT_EQ(b[599], 4);
+    b.resize(1);
+    ASSERT_EQ(b.size(), 1);
+    b.assign(3000, 2);
+    ASSERT_EQ(std::accumulate(b.begin(), b.end(), 0), 6000);
+    b.swap(c);
+    ASSERT_EQ(b.size(), 3);
+    ASSERT_EQ(c.size(), 3000);
+
+    moved = std::move(a);
+    ASSERT_EQ(moved.size(), 100);
+    moved.push_front(moved.back());
+    moved.push_back(moved.front());
+    ASSERT_EQ(moved.size(), 102);
+    ASSERT_EQ(moved.back(), "seven");
+}
+
+void test_exception_safety(testing::Test*) {
+    tracked::live = 0;
+    {
+        devector<tracked> d;
+        for (int i = 0; i < 1000; ++i)
+            d.emplace_back(i);
+        d.shrink_to_fit();
+        tracked::copies   = 0;
+        tracked::throw_at = 0;
+        ASSERT_THROW(d.push_front(d.back()), std::runtime_error);
+        tracked::copies = 0;
+        ASSERT_THROW(d.push_back(d.front()), std::runtime_error);
+        tracked::copies = 0;
+        ASSERT_THROW(d.insert(d.begin() + 500, d.front()), std::runtime_error);
+        ASSERT_EQ(d.size(), 1000);
+        ASSERT_EQ(tracked::live, 1000);
+
+        tracked::copies   = 0;
+        tracked::throw_at = 5;
+        const tracked value(7);
+        ASSERT_THROW(d.insert(d.begin() + 100, 10, value), std::runtime_error);
+        ASSERT_EQ(d.size(), 1000);
+        ASSERT_EQ(tracked::live, 1001);
+        for (int i = 0; i < 1000; ++i)
+            ASSERT_EQ(d[static_cast<std::size_t>(i)].value, i);
+
+        tracked::copies   = 0;
+        tracked::throw_at = 500;
+        ASSERT_THROW(devector<tracked> copy(d), std::runtime_error);
+        ASSERT_EQ(tracked::live, 1001);
+        tracked::throw_at = -1;
+    }
+    ASSERT_EQ(tracked::live, 0);
+}
+
+} // end of unnamed namespace
+
+TEST(devector, random_ops) {
+    test_random_ops(this);
+}
+
+TEST(devector, contiguous) {
+    test_contiguous(this);
+}
+
+TEST(devector, capacity) {
+    test_capacity(this);
+}
+
+TEST(devector, shift_side) {
+    test_shift_side(this);
+}
+
+TEST(devector, constructor_and_assignment) {
+    test_constructor_and_assignment(this);
+}
+
+TEST(devector, exception_safety) {
+    test_exception_safety(this);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <tgp/flat_map.h>
+
+using namespace tgp;
+
+namespace {
+
+// applies the same random operations to a flat_map and a std::map
+void test_random_ops(testing::Test*) {
+    flat_map<int, std::string> m;
+    std::map<int, std::string> expected;
+    std::minstd_rand rng{12345};
+    for (int i = 0; i < 5000; ++i) {
+        const auto r = static_cast<std::uint32_t>(rng());
+        const int key = static_cast<int>((r >> 8) % 1000);
+        switch ((r >> 20) % 6) {
+        case 0: {
+            const auto [it, inserted] = m.try_emplace(key, std::to_string(i));
+            ASSERT_EQ(inserted, expected.try_emplace(key, std::to_string(i)).second);
+            ASSERT_EQ(it->first, key);
+            break;
+        }
+        case 1:
+            m.insert_or_assign(key, std::to_string(i));
+            expected.insert_or_assign(key, std::to_string(i));
+            break;
+        case 2:
+            ASSERT_EQ(m.erase(key), expected.erase(key));
+            break;
+        case 3:
+            m[key] += "x";
+            expected[key] += "x";
+            break;
+        case 4: {
+            std::vector<std::pair<int, std::string>> batch;
+            for (int j = 0; j < 20; ++j)
+                batch.emplace_back(static_cast<int>((r >> j) % 1000), std::to_string(j));
+            m.insert(batch.begin(), batch.end());
+            expected.insert(batch.begin(), batch.end());
+            break;
+        }
+        default:
+            ASSERT_EQ(m.contains(key), expected.count(key) == 1);
+            break;
+        }
+        ASSERT_EQ(m.size(), expected.size());
+    }
+    ASSERT_TRUE(std::equal(m.begin(), m.end(), expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return a.first == b.first && a.second == b.second;
+    }));
+}
+
+// inserting a range keeps the elements already there and the first of equivalent incoming ones
+void test_bulk_insert(testing::Test*) {
+    flat_map<int, int> m{{5, 50}, {1, 10}, {3, 30}};
+    ASSERT_TRUE(std::is_sorted(m.keys().begin(), m.keys().end()));
+
+    const std::pair<int, int> batch[] = {{4, 40}, {3, -1}, {9, 90}, {0, 0}, {4, -1}, {2, 20}};
+    m.insert(std::begin(batch), std::end(batch));
+    const int keys[]   = {0, 1, 2, 3, 4, 5, 9};
+    const int values[] = {0, 10, 20, 30, 40, 50, 90};
+    ASSERT_TRUE(std::equal(m.keys().begin(), m.keys().end(), std::begin(keys), std::end(keys)));
+    ASSERT_TRUE(std::equal(m.values().begin(), m.values().end(), std::begin(values), std::end(values)));
+
+    m.insert(sorted_unique, {{6, 60}, {7, 70}, {9, -1}});
+    ASSERT_EQ(m.size(), 9);
+    ASSERT_EQ(m.at(7), 70);
+    ASSERT_EQ(m.at(9), 90);
+
+    flat_map<int, int> sorted(sorted_unique, {{1, 1}, {2, 2}, {3, 3}});
+    ASSERT_EQ(sorted.size(), 3);
+    flat_map<int, int> from_columns(vector<int>{3, 1, 3, 2}, vector<int>{30, 10, -1, 20});
+    ASSERT_EQ(from_columns.size(), 3);
+    ASSERT_EQ(from_columns.at(3), 30);
+    ASSERT_EQ(from_columns.begin()->second, 10);
+}
+
+// std::less<> lets string_views look up string keys without building a string
+void test_heterogeneous_lookup(testing::Test*) {
+    flat_map<std::string, int, std::less<>> m{{"apple", 1}, {"banana", 2}, {"cherry", 3}};
+    const std::string_view key = "banana";
+    ASSERT_EQ(m.find(key)->second, 2);
+    ASSERT_TRUE(m.contains(std::string_view("cherry")));
+    ASSERT_EQ(m.count(std::string_view("durian")), 0);
+    ASSERT_EQ(m.at(std::string_view("apple")), 1);
+    ASSERT_EQ(m.lower_bound(std::string_view("b"))->first, "banana");
+    ASSERT_EQ(m.upper_bound(std::string_view("banana"))->first, "cherry");
+    const auto [first, last] = m.equal_range(std::string_view("banana"));
+    ASSERT_EQ(last - first, 1);
+    ASSERT_EQ(m.erase(std::string_view("apple")), 1);
+    ASSERT_EQ(m.size(), 2);
+    ASSERT_THROW(static_cast<void>(m.at(std::string_view("apple"))), std::out_of_range);
+}
+
+// extract hands the columns over without copying, replace takes them back
+void test_extract_and_replace(testing::Test*) {
+    flat_map<int, std::string> m{{1, "one"}, {2, "two"}, {3, "three"}};
+    const int* keys = m.keys().data();
+    const std::string* values = m.values().data();
+
+    auto c = std::move(m).extract();
+    ASSERT_TRUE(m.empty());
+    ASSERT_EQ(c.keys.data(), keys);
+    ASSERT_EQ(c.values.data(), values);
+    ASSERT_EQ(c.values[1], "two");
+
+    c.keys.push_back(4);
+    c.values.push_back("four");
+    keys = c.keys.data();
+    m.replace(std::move(c.keys), std::move(c.values));
+    ASSERT_EQ(m.keys().data(), keys);
+    ASSERT_EQ(m.at(4), "four");
+}
+
+void test_iterators_and_erase(testing::Test*) {
+    static_assert(std::random_access_iterator<flat_map<int, int>::iterator>);
+
+    flat_map<int, int> m;
+    for (int i = 0; i < 10; ++i)
+        m.emplace(i, i * i);
+    for (auto [key, value] : m)
+        value += key;
+    ASSERT_EQ(m.at(3), 12);
+    ASSERT_EQ((m.begin() + 4)->second, 20);
+    ASSERT_EQ(m.end() - m.begin(), 10);
+    ASSERT_EQ(m.rbegin()->first, 9);
+
+    auto it = m.erase(m.find(4));
+    ASSERT_EQ(it->first, 5);
+    it = m.erase(m.cbegin(), m.cbegin() + 2);
+    ASSERT_EQ(it->first, 2);
+    ASSERT_EQ(m.size(), 7);
+    ASSERT_EQ(m.keys().size(), m.values().size());
+
+    const flat_map<int, int>& cm = m;
+    flat_map<int, int>::const_iterator ci = cm.find(9);
+    ASSERT_EQ(ci->second, 90);
+    ASSERT_TRUE(cm.find(4) == cm.end());
+
+    flat_map<int, int> copy(m);
+    ASSERT_TRUE(copy == m);
+    copy[100] = 1;
+    ASSERT_TRUE(copy != m);
+    swap(copy, m);
+    ASSERT_EQ(m.size(), 8);
+}
+
+} // end of unnamed namespace
+
+TEST(flat_map, random_ops) {
+    test_random_ops(this);
+}
+
+TEST(flat_map, bulk_insert) {
+    test_bulk_insert(this);
+}
+
+TEST(flat_map, heterogeneous_lookup) {
+    test_heterogeneous_lookup(this);
+}
+
+TEST(flat_map, extract_and_replace) {
+    test_extract_and_replace(this);
+}
+
+TEST(flat_map, iterators_and_erase) {
+    test_iterators_and_erase(this);
+}
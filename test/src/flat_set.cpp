@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tgp/flat_set.h>
+
+using namespace tgp;
+
+namespace {
+
+// applies the same random operations to a flat_set and a std::set
+void test_random_ops(testing::Test*) {
+    flat_set<int> s;
+    std::set<int> expected;
+    std::minstd_rand rng{12345};
+    for (int i = 0; i < 5000; ++i) {
+        const auto r = static_cast<std::uint32_t>(rng());
+        const int key = static_cast<int>((r >> 8) % 1000);
+        switch ((r >> 20) % 4) {
+        case 0:
+            ASSERT_EQ(s.insert(key).second, expected.insert(key).second);
+            break;
+        case 1:
+            ASSERT_EQ(s.erase(key), expected.erase(key));
+            break;
+        case 2: {
+            std::vector<int> batch;
+            for (int j = 0; j < 20; ++j)
+                batch.push_back(static_cast<int>((r >> j) % 1000));
+            s.insert(batch.begin(), batch.end());
+            expected.insert(batch.begin(), batch.end());
+            break;
+        }
+        default:
+            ASSERT_EQ(s.contains(key), expected.count(key) == 1);
+            break;
+        }
+        ASSERT_EQ(s.size(), expected.size());
+    }
+    ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+}
+
+void test_construction(testing::Test*) {
+    flat_set<int> a{5, 3, 5, 1, 3};
+    const int expected[] = {1, 3, 5};
+    ASSERT_TRUE(std::equal(a.begin(), a.end(), std::begin(expected), std::end(expected)));
+
+    flat_set<int> b(vector<int>{9, 7, 9, 8});
+    ASSERT_EQ(b.size(), 3);
+    ASSERT_EQ(*b.begin(), 7);
+
+    flat_set<int> c(sorted_unique, {1, 2, 3});
+    ASSERT_EQ(c.size(), 3);
+    c.insert(sorted_unique, {0, 2, 4});
+    ASSERT_EQ(c.size(), 5);
+    ASSERT_EQ(*c.rbegin(), 4);
+
+    flat_set<int, std::greater<int>> d{1, 2, 3};
+    ASSERT_EQ(*d.begin(), 3);
+    ASSERT_TRUE(d.contains(2));
+}
+
+void test_heterogeneous_lookup(testing::Test*) {
+    flat_set<std::string, std::less<>> s{"apple", "banana", "cherry"};
+    ASSERT_EQ(*s.find(std::string_view("banana")), "banana");
+    ASSERT_TRUE(s.contains(std::string_view("cherry")));
+    ASSERT_EQ(s.count(std::string_view("durian")), 0);
+    ASSERT_EQ(*s.lower_bound(std::string_view("b")), "banana");
+    ASSERT_EQ(s.erase(std::string_view("apple")), 1);
+    ASSERT_EQ(s.size(), 2);
+}
+
+void test_extract_and_replace(testing::Test*) {
+    flat_set<int> s{3, 1, 2};
+    const int* data = s.keys().data();
+    vector<int> keys = std::move(s).extract();
+    ASSERT_TRUE(s.empty());
+    ASSERT_EQ(keys.data(), data);
+    keys.push_back(10);
+    data = keys.data();
+    s.replace(std::move(keys));
+    ASSERT_EQ(s.keys().data(), data);
+    ASSERT_TRUE(s.contains(10));
+    ASSERT_EQ(*s.erase(s.find(2)), 3);
+}
+
+} // end of unnamed namespace
+
+TEST(flat_set, random_ops) {
+    test_random_ops(this);
+}
+
+TEST(flat_set, construction) {
+    test_construction(this);
+}
+
+TEST(flat_set, heterogeneous_lookup) {
+    test_heterogeneous_lookup(this);
+}
+
+TEST(flat_set, extract_and_replace) {
+    test_extract_and_replace(this);
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <tgp/deque.h>
+#include <tgp/devector.h>
+#include <tgp/static_vector.h>
+#include <tgp/vector.h>
+
+#if TGP_HARDENING_MODE != TGP_HARDENING_MODE_FAST
+#   error "hardening.cpp tests the fast mode, build it with TGP_HARDENING_MODE=TGP_HARDENING_MODE_FAST"
+#endif
+
+using namespace tgp;
+
+TEST(hardening, disabled_levels_are_not_evaluated) {
+    int evaluated = 0;
+    TGP_PRECONDITION(++evaluated > 0);
+    TGP_ASSERT_SEMANTIC_REQUIREMENT(++evaluated > 0);
+    TGP_POSTCONDITION(++evaluated > 0);
+    ASSERT_EQ(evaluated, 0);
+    TGP_ASSERT_VALID_ELEMENT_ACCESS(++evaluated > 0);
+    TGP_ASSERT_VALID_INPUT_RANGE(++evaluated > 0);
+    ASSERT_EQ(evaluated, 2);
+}
+
+TEST(hardening, element_access) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    vector<int> v{1, 2, 3};
+    ASSERT_EQ(v[2], 3);
+    EXPECT_DEATH((void)v[3], "");
+    v.clear();
+    EXPECT_DEATH((void)v.front(), "");
+    EXPECT_DEATH((void)v.back(), "");
+    EXPECT_DEATH(v.pop_back(), "");
+    EXPECT_DEATH(v.erase(v.end()), "");
+
+    static_vector<std::string, 4> s{"a"};
+    EXPECT_DEATH((void)s[1], "");
+    EXPECT_DEATH(s.erase(s.begin() + 1, s.begin()), "");
+    s.pop_back();
+    EXPECT_DEATH(s.pop_back(), "");
+
+    devector<int> d;
+    EXPECT_DEATH(d.pop_front(), "");
+    deque<int> q;
+    EXPECT_DEATH((void)q.back(), "");
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <tgp/mmap_vector.h>
+#include <tgp/vector.h>
+
+using namespace tgp;
+
+namespace {
+
+struct record {
+    std::uint64_t key;
+    double        value;
+
+    friend bool operator==(const record& lhs, const record& rhs) {
+        return lhs.key == rhs.key && lhs.value == rhs.value;
+    }
+};
+
+std::string temp_path(const char* name) {
+    std::string path = testing::TempDir() + name;
+    std::remove(path.c_str());
+    return path;
+}
+
+std::size_t file_size(const std::string& path) {
+    struct stat st;
+    return ::stat(path.c_str(), &st) == 0 ? static_cast<std::size_t>(st.st_size) : 0;
+}
+
+void test_persistence(testing::Test*) {
+    const std::string path = temp_path("tgp_mmap_vector_persistence");
+    vector<record> expected;
+    {
+        mmap_vector<record> c(path.c_str());
+        ASSERT_TRUE(c.empty());
+        for (std::uint64_t i = 0; i < 100000; ++i) {
+            c.push_back({i, static_cast<double>(i) / 2});
+            expected.push_back({i, static_cast<double>(i) / 2});
+        }
+        c.emplace_back(c[7]);
+        expected.push_back(expected[7]);
+        c.sync();
+    }
+    {
+        const mmap_vector<record> c(path.c_str(), mmap_mode::read_only);
+        ASSERT_FALSE(c.writable());
+        ASSERT_EQ(c.size(), expected.size());
+        ASSERT_TRUE(c == expected);
+        ASSERT_EQ(c.back(), expected[7]);
+    }
+    {
+        // modifiers of a read-only mapping throw in every hardening mode instead of writing to its pages
+        mmap_vector<record> c(path.c_str(), mmap_mode::read_only);
+        ASSERT_THROW(c.clear(), std::logic_error);
+        ASSERT_THROW(c.push_back(record{}), std::logic_error);
+        ASSERT_THROW(c.pop_back(), std::logic_error);
+        ASSERT_THROW(c.resize(3), std::logic_error);
+        ASSERT_THROW(c.reserve(c.capacity() + 1), std::logic_error);
+        ASSERT_THROW(c.shrink_to_fit(), std::logic_error);
+        ASSERT_THROW(c.assign(expected.begin(), expected.begin() + 1), std::logic_error);
+        ASSERT_EQ(c.size(), expected.size());
+    }
+    {
+        mmap_vector<record> c(path.c_str());
+        c.resize(10);
+        c.shrink_to_fit();
+        ASSERT_EQ(file_size(path), page_size());
+        c.resize(20, c[3]);
+        ASSERT_EQ(c[19], expected[3]);
+
+        mmap_vector<record> d(std::move(c));
+        ASSERT_EQ(d.size(), 20);
+        ASSERT_EQ(c.data(), nullptr);
+        ASSERT_EQ(c.begin(), c.end());
+        c = std::move(d);
+        ASSERT_EQ(c.size(), 20);
+    }
+    std::remove(path.c_str());
+}
+
+void test_assign_and_compare(testing::Test*) {
+    const std::string path = temp_path("tgp_mmap_vector_assign");
+    const vector<int> source{5, 3, 8, 1};
+    mmap_vector<int> c(path.c_str());
+    c.assign(source.begin(), source.end());
+    ASSERT_TRUE(c == source);
+    c.pop_back();
+    ASSERT_TRUE(c != source);
+    ASSERT_TRUE(c < source);
+    c.clear();
+    ASSERT_TRUE(c.empty());
+    ASSERT_THROW(static_cast<void>(c.at(0)), std::out_of_range);
+    std::remove(path.c_str());
+}
+
+void test_type_mismatch(testing::Test*) {
+    const std::string path = temp_path("tgp_mmap_vector_mismatch");
+    {
+        mmap_vector<int> c(path.c_str());
+        c.push_back(1);
+    }
+    ASSERT_THROW(mmap_vector<record>(path.c_str()), std::runtime_error);
+    ASSERT_THROW(mmap_vector<int>((path + "_missing").c_str(), mmap_mode::read_only), std::system_error);
+    std::remove(path.c_str());
+}
+
+} // end of unnamed namespace
+
+TEST(mmap_vector, persistence) {
+    test_persistence(this);
+}
+
+TEST(mmap_vector, assign_and_compare) {
+    test_assign_and_compare(this);
+}
+
+TEST(mmap_vector, type_mismatch) {
+    test_type_mismatch(this);
+}
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <tgp/recycling_allocator.h>
+#include <tgp/vector.h>
+
+using namespace tgp;
+
+namespace {
+
+template<class T>
+using recycling_vector = vector<T, recycling_allocator<T>>;
+
+struct alignas(64) cache_line {
+    int value;
+};
+
+// starts each test with an empty cache of the default limits
+recycling_cache& fresh_cache() {
+    recycling_cache& cache = recycling_cache::local();
+    cache.set_limits(recycling_limits());
+    cache.trim();
+    cache.reset_stats();
+    return cache;
+}
+
+} // end of unnamed namespace
+
+TEST(recycling_allocator, size_classes) {
+    for (std::size_t i = 0; i < recycling_class_count; ++i) {
+        ASSERT_EQ(recycling_size_class(recycling_class_bytes(i)), i);
+        ASSERT_EQ(recycling_size_class(recycling_class_bytes(i) + 1), i + 1);
+    }
+    ASSERT_EQ(recycling_size_class(1), 0);
+    ASSERT_EQ(recycling_class_bytes(4), 128);
+    ASSERT_EQ(recycling_class_bytes(5), 160);
+}
+
+TEST(recycling_allocator, reuse) {
+    recycling_cache& cache = fresh_cache();
+    recycling_allocator<int> alloc;
+    auto a = alloc.allocate_at_least(100);
+    ASSERT_GE(a.count, 100);
+    alloc.deallocate(a.ptr, a.count);
+    auto b = alloc.allocate_at_least(100);
+    ASSERT_EQ(b.ptr, a.ptr);
+    alloc.deallocate(b.ptr, 100);
+    ASSERT_EQ(cache.stats().upstream_allocations, 1);
+    ASSERT_EQ(cache.stats().hits, 1);
+
+    // the same growth twice, the second time without operator new
+    for (int round = 0; round < 2; ++round) {
+        const auto before = cache.stats().upstream_allocations;
+        recycling_vector<std::string> v;
+        for (int i = 0; i < 1000; ++i)
+            v.emplace_back(20, static_cast<char>('a' + i % 26));
+        recycling_vector<std::uint64_t> w(v.size(), 7);
+        for (int i = 0; i < 1000; ++i)
+            ASSERT_EQ(v[i], std::string(20, static_cast<char>('a' + i % 26)));
+        if (round == 1) {
+            ASSERT_EQ(cache.stats().upstream_allocations, before);
+        }
+    }
+
+    // over-aligned elements bypass the cache
+    recycling_vector<cache_line> lines(10);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(lines.data()) % 64, 0);
+}
+
+TEST(recycling_allocator, limits) {
+    recycling_cache& cache = fresh_cache();
+    recycling_allocator<char> alloc;
+    char* small = alloc.allocate(1000);
+    char* large = alloc.allocate(std::size_t(1) << 21);
+    char* huge  = alloc.allocate(std::size_t(1) << 25);
+    alloc.deallocate(huge, std::size_t(1) << 25);
+    // above max_block_bytes
+    alloc.deallocate(large, std::size_t(1) << 21);
+    alloc.deallocate(small, 1000);
+    ASSERT_EQ(cache.cached_bytes(), recycling_class_bytes(recycling_size_class(1000 + recycling_cache::header_size)));
+
+    recycling_limits limits;
+    limits.max_cached_bytes = 4096;
+    cache.set_limits(limits);
+    char* blocks[8];
+    for (auto& p : blocks)
+        p = alloc.allocate(1000);
+    for (auto* p : blocks)
+        alloc.deallocate(p, 1000);
+    ASSERT_LE(cache.cached_bytes(), 4096);
+    ASSERT_GT(cache.cached_bytes(), 0);
+
+    cache.trim(1024);
+    ASSERT_LE(cache.cached_bytes(), 1024);
+    const auto freed = cache.stats().upstream_deallocations;
+    cache.trim();
+    ASSERT_EQ(cache.cached_bytes(), 0);
+    ASSERT_GT(cache.stats().upstream_deallocations, freed);
+    cache.set_limits(recycling_limits());
+}
+
+TEST(recycling_allocator, remote_free) {
+    recycling_cache& cache = fresh_cache();
+    recycling_allocator<int> alloc;
+    std::vector<int*> blocks;
+    for (int i = 0; i < 6; ++i)
+        blocks.push_back(alloc.allocate(200));
+    ASSERT_EQ(cache.stats().upstream_allocations, 6);
+
+    recycling_stats remote;
+    std::thread([&] {
+        recycling_cache& other = recycling_cache::local();
+        recycling_limits limits;
+        limits.remote_batch_size = 4;
+        other.set_limits(limits);
+        for (int* p : blocks)
+            recycling_allocator<int>().deallocate(p, 200);
+        remote = other.stats();
+        // the last two go back when the thread exits
+    }).join();
+    ASSERT_EQ(remote.remote_batches, 1);
+    ASSERT_EQ(remote.upstream_deallocations, 0);
+
+    for (int i = 0; i < 6; ++i)
+        blocks[i] = alloc.allocate(200);
+    ASSERT_EQ(cache.stats().upstream_allocations, 6);
+    ASSERT_EQ(cache.stats().hits, 6);
+    for (int* p : blocks)
+        alloc.deallocate(p, 200);
+}
+
+TEST(recycling_allocator, owner_exit) {
+    fresh_cache();
+    recycling_vector<std::string> v;
+    recycling_vector<int> w;
+    std::thread([&] {
+        recycling_vector<std::string> local{"a", "b", std::string(40, 'c')};
+        recycling_vector<int> numbers(1000, 3);
+        v = std::move(local);
+        w = std::move(numbers);
+    }).join();
+    // the blocks outlive the thread that allocated them and are freed here
+    ASSERT_EQ(v[2], std::string(40, 'c'));
+    v.push_back("d");
+    w.resize(5000, 4);
+    ASSERT_EQ(w[999], 3);
+    ASSERT_EQ(w[4999], 4);
+    v = recycling_vector<std::string>();
+    w = recycling_vector<int>();
+}
+
+TEST(recycling_allocator, concurrent) {
+    constexpr int threads = 4, rounds = 2000;
+    std::mutex mutex;
+    std::vector<recycling_vector<int>> shared;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < rounds; ++i) {
+                recycling_vector<int> v;
+                for (int j = 0; j < i % 300; ++j)
+                    v.push_back(t);
+                // hands its vector to another thread and frees the one it takes
+                recycling_vector<int> taken;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    shared.push_back(std::move(v));
+                    taken = std::move(shared.front());
+                    shared.erase(shared.begin());
+                }
+                for (int x : taken)
+                    ASSERT_EQ(x, taken.front());
+            }
+            recycling_cache::local().flush();
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+    ASSERT_TRUE(shared.empty());
+}
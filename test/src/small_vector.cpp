@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <tgp/arena.h>
+#include <tgp/small_vector.h>
+
+#include "test_types.h"
+
+using namespace tgp;
+
+namespace {
+
+template<class T>
+using sv = small_vector<T, 4, counting_allocator<T>>;
+
+static_assert(std::is_nothrow_move_assignable_v<small_vector<int, 4>>);
+static_assert(std::is_nothrow_swappable_v<small_vector<int, 4>>);
+// moving between two arenas copies the heap elements into a new block, which may throw
+static_assert(!std::is_nothrow_move_assignable_v<small_vector<int, 4, arena_allocator<int>>>);
+static_assert(!std::is_nothrow_swappable_v<small_vector<int, 4, arena_allocator<int>>>);
+
+// rebinding to the element type keeps the inline buffer, other types go upstream
+using int_buffer_allocator = small_buffer_allocator<int, 4, std::allocator<int>>;
+static_assert(std::is_same_v<std::allocator_traits<int_buffer_allocator>::rebind_alloc<int>, int_buffer_allocator>);
+static_assert(std::is_same_v<std::allocator_traits<int_buffer_allocator>::rebind_alloc<long>, std::allocator<long>>);
+
+template<class T>
+T make(int i) {
+    if constexpr (std::is_same_v<T, std::string>)
+        return std::string(32, static_cast<char>('a' + i));
+    else
+        return T(i);
+}
+
+template<class C>
+void expect_sequence(const C& c, int first, int count) {
+    using T = typename C::value_type;
+    ASSERT_EQ(c.size(), static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i)
+        EXPECT_EQ(c[i], make<T>(first + i));
+}
+
+template<class C>
+C make_sequence(int first, int count) {
+    C c;
+    for (int i = 0; i < count; ++i)
+        c.push_back(make<typename C::value_type>(first + i));
+    return c;
+}
+
+template<class T>
+void test_inline_storage(testing::Test*) {
+    using C = sv<T>;
+    allocation_counter::allocations = 0;
+    {
+        C c;
+        EXPECT_TRUE(c.is_inline());
+        EXPECT_EQ(c.capacity(), C::inline_capacity);
+        for (int i = 0; i < 4; ++i)
+            c.emplace_back(make<T>(i));
+        c.insert(c.begin() + 1, make<T>(9));
+        EXPECT_FALSE(c.is_inline());
+        EXPECT_EQ(allocation_counter::allocations, 1u);
+        c.erase(c.begin() + 1);
+        expect_sequence(c, 0, 4);
+
+        c.shrink_to_fit();
+        EXPECT_TRUE(c.is_inline());
+        EXPECT_EQ(allocation_counter::live, 0u);
+        expect_sequence(c, 0, 4);
+
+        c.assign(3, make<T>(7));
+        EXPECT_EQ(c.size(), 3u);
+        EXPECT_EQ(c.back(), make<T>(7));
+        c.resize(1);
+        c.insert(c.end(), {make<T>(1), make<T>(2)});
+        EXPECT_TRUE(c.is_inline());
+        EXPECT_EQ(allocation_counter::allocations, 1u);
+    }
+    EXPECT_EQ(allocation_counter::live, 0u);
+}
+
+template<class T>
+void test_move(testing::Test*) {
+    using C = sv<T>;
+    for (int n : {0, 3, 4, 9}) {
+        for (int m : {0, 2, 7}) {
+            {
+                C from = make_sequence<C>(0, n);
+                const T* data = from.data();
+                C to(std::move(from));
+                expect_sequence(to, 0, n);
+                EXPECT_TRUE(from.empty());
+                EXPECT_TRUE(from.is_inline());
+                EXPECT_EQ(to.is_inline(), n <= 4);
+                if (n > 4) {
+                    EXPECT_EQ(to.data(), data);
+                }
+
+                C other = make_sequence<C>(20, m);
+                other = std::move(to);
+                expect_sequence(other, 0, n);
+                EXPECT_TRUE(to.empty());
+                EXPECT_TRUE(to.is_inline());
+
+                to.push_back(make<T>(5));
+                EXPECT_EQ(to.back(), make<T>(5));
+
+                C copy(other);
+                expect_sequence(copy, 0, n);
+                copy = to;
+                expect_sequence(copy, 5, 1);
+            }
+            EXPECT_EQ(allocation_counter::live, 0u);
+        }
+    }
+}
+
+template<class T>
+void test_swap(testing::Test*) {
+    using C = sv<T>;
+    for (int n : {0, 3, 9}) {
+        for (int m : {0, 2, 7}) {
+            {
+                C a = make_sequence<C>(0, n);
+                C b = make_sequence<C>(20, m);
+                a.swap(b);
+                expect_sequence(a, 20, m);
+                expect_sequence(b, 0, n);
+                EXPECT_EQ(a.is_inline(), m <= 4);
+                EXPECT_EQ(b.is_inline(), n <= 4);
+                std::swap(a, b);
+                expect_sequence(a, 0, n);
+                expect_sequence(b, 20, m);
+                a.swap(a);
+                expect_sequence(a, 0, n);
+            }
+            EXPECT_EQ(allocation_counter::live, 0u);
+        }
+    }
+}
+
+} // end of unnamed namespace
+
+TEST(small_vector, inline_storage) {
+    test_inline_storage<int>(this);
+    test_inline_storage<std::string>(this);
+}
+
+TEST(small_vector, move) {
+    test_move<int>(this);
+    test_move<std::string>(this);
+}
+
+TEST(small_vector, swap) {
+    test_swap<int>(this);
+    test_swap<std::string>(this);
+}
+
+TEST(small_vector, erase_if) {
+    small_vector<int, 8> c{0, 1, 2, 3, 4, 5, 6, 7};
+    ASSERT_EQ(erase_if(c, [](int v) { return v % 2 == 0; }), 4);
+    ASSERT_EQ(erase(c, 5), 1);
+    ASSERT_EQ(*c.erase_unordered(c.begin()), 7);
+    const int indices[] = {1};
+    ASSERT_EQ(c.erase_indices(indices), 1);
+    ASSERT_EQ(c.size(), 1);
+    ASSERT_EQ(c[0], 7);
+}
@@ -0,0 +1,270 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <tgp/soa_vector.h>
+
+#include "test_types.h"
+
+using namespace tgp;
+
+namespace {
+
+// applies the same operations to a soa_vector and a vector of tuples
+void test_random_ops(testing::Test*) {
+    soa_vector<int, std::string, double> s;
+    std::vector<std::tuple<int, std::string, double>> expected;
+    std::minstd_rand rng{12345};
+    for (int i = 0; i < 5000; ++i) {
+        const auto r = static_cast<std::uint32_t>(rng());
+        switch ((r >> 20) % 6) {
+        case 0:
+        case 1:
+            s.emplace_back(i, std::to_string(i) + std::string(20, 'x'), i * 0.5);
+            expected.emplace_back(i, std::to_string(i) + std::string(20, 'x'), i * 0.5);
+            break;
+        case 2:
+            if (!expected.empty()) {
+                s.push_back(expected[r % expected.size()]);
+                expected.push_back(expected[r % expected.size()]);
+            }
+            break;
+        case 3:
+            if (!expected.empty()) {
+                s.pop_back();
+                expected.pop_back();
+            }
+            break;
+        case 4:
+            s.resize(expected.size() + r % 5);
+            expected.resize(expected.size() + r % 5);
+            break;
+        default:
+            if (!expected.empty()) {
+                const std::size_t n = expected.size() - r % std::min<std::size_t>(expected.size(), 3);
+                s.resize(n);
+                expected.resize(n);
+            }
+            break;
+        }
+        ASSERT_EQ(s.size(), expected.size());
+        ASSERT_LE(s.size(), s.capacity());
+    }
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        ASSERT_TRUE(s[i] == expected[i]);
+}
+
+// each column is one array, rows are references into them
+void test_columns(testing::Test*) {
+    soa_vector<std::uint32_t, float, std::uint8_t> s;
+    for (std::uint32_t i = 0; i < 1000; ++i)
+        s.emplace_back(i, static_cast<float>(i) * 2, static_cast<std::uint8_t>(i));
+
+    const std::span<std::uint32_t> ids = s.column<0>();
+    ASSERT_EQ(ids.size(), 1000);
+    ASSERT_EQ(ids.data(), s.data<0>());
+    ASSERT_EQ(std::accumulate(ids.begin(), ids.end(), std::uint64_t(0)), 999 * 1000 / 2);
+    ASSERT_EQ(s.column<2>()[300], static_cast<std::uint8_t>(300));
+
+    auto [id, weight, tag] = s[10];
+    weight = -1;
+    ASSERT_EQ(id, 10);
+    ASSERT_EQ(s.column<1>()[10], -1);
+    std::get<2>(s.back()) = 7;
+    ASSERT_EQ(s.column<2>()[999], 7);
+    s[5] = std::make_tuple(50u, 5.0f, std::uint8_t(5));
+    ASSERT_EQ(s.column<0>()[5], 50);
+    ASSERT_EQ(std::get<1>(s.at(5)), 5.0f);
+    ASSERT_THROW(static_cast<void>(s.at(1000)), std::out_of_range);
+
+    const auto& cs = s;
+    ASSERT_EQ(cs.column<1>().data(), s.data<1>());
+    ASSERT_EQ(std::get<0>(cs.front()), 0);
+}
+
+void test_iterators(testing::Test*) {
+    soa_vector<int, char> s;
+    for (int i = 0; i < 100; ++i)
+        s.emplace_back(i, static_cast<char>('a' + i % 26));
+    ASSERT_EQ(std::distance(s.begin(), s.end()), 100);
+    ASSERT_EQ(s.end() - s.begin(), 100);
+
+    const auto it = std::find_if(s.begin(), s.end(), [](const auto& row) { return std::get<1>(row) == 'z'; });
+    ASSERT_EQ(it - s.begin(), 25);
+    ASSERT_EQ(std::get<0>(*it), 25);
+    ASSERT_EQ(std::get<0>(it[10]), 35);
+
+    int sum = 0;
+    for (auto [value, letter] : s) {
+        sum += value;
+        letter = 'q';
+    }
+    ASSERT_EQ(sum, 99 * 100 / 2);
+    ASSERT_EQ(std::count(s.column<1>().begin(), s.column<1>().end(), 'q'), 100);
+
+    soa_vector<int, char>::const_iterator c = s.begin();
+    c += 99;
+    ASSERT_TRUE(c < s.cend());
+    ASSERT_TRUE(++c == s.cend());
+    ASSERT_EQ(std::get<0>(*--c), 99);
+}
+
+// rows move as a whole, so sorting by one column carries the others along
+void test_sort(testing::Test*) {
+    static_assert(std::sortable<soa_vector<int, std::string>::iterator>);
+    soa_vector<int, std::string> s;
+    for (int i = 0; i < 200; ++i) {
+        const int key = i * 37 % 200;
+        s.emplace_back(key, std::string(20, static_cast<char>('a' + key % 26)) + std::to_string(key));
+    }
+    std::ranges::sort(s, {}, [](const auto& row) { return std::get<0>(row); });
+    for (int i = 0; i < 200; ++i) {
+        ASSERT_EQ(std::get<0>(s[i]), i);
+        ASSERT_EQ(std::get<1>(s[i]), std::string(20, static_cast<char>('a' + i % 26)) + std::to_string(i));
+    }
+
+    std::ranges::reverse(s);
+    ASSERT_EQ(std::get<0>(s.front()), 199);
+    const auto even = std::ranges::partition(s, [](const auto& row) { return std::get<0>(row) % 2 == 1; });
+    ASSERT_EQ(even.begin() - s.begin(), 100);
+    for (int i = 0; i < 200; ++i) {
+        const auto [key, name] = s[i];
+        ASSERT_EQ(key % 2 == 1, i < 100);
+        ASSERT_EQ(name, std::string(20, static_cast<char>('a' + key % 26)) + std::to_string(key));
+    }
+
+    // a row assigns through and swaps the elements it refers to
+    const int first = std::get<0>(s[0]), second = std::get<0>(s[1]);
+    swap(s[0], s[1]);
+    ASSERT_EQ(std::get<0>(s[0]), second);
+    ASSERT_EQ(std::get<0>(s[1]), first);
+    s[2] = s[0];
+    ASSERT_EQ(std::get<1>(s[2]), std::get<1>(s[0]));
+    s[3] = std::tuple(-1, std::string("moved"));
+    ASSERT_EQ(std::get<1>(s[3]), "moved");
+}
+
+void test_capacity(testing::Test*) {
+    soa_vector<std::uint64_t, std::string> s;
+    s.reserve(100);
+    ASSERT_EQ(s.capacity(), 100);
+    const std::uint64_t* data = s.data<0>();
+    for (std::uint64_t i = 0; i < 100; ++i)
+        s.emplace_back(i, std::to_string(i));
+    ASSERT_EQ(s.data<0>(), data);
+    s.emplace_back(100, "100");
+    ASSERT_GT(s.capacity(), 101);
+    s.shrink_to_fit();
+    ASSERT_EQ(s.capacity(), 101);
+    for (std::uint64_t i = 0; i <= 100; ++i)
+        ASSERT_EQ(s.column<1>()[i], std::to_string(i));
+    s.clear();
+    ASSERT_TRUE(s.empty());
+    s.shrink_to_fit();
+    ASSERT_EQ(s.capacity(), 0);
+    ASSERT_EQ(s.data<1>(), nullptr);
+}
+
+void test_constructor_and_assignment(testing::Test*) {
+    soa_vector<int, std::string> a(10, {7, "seven"});
+    ASSERT_EQ(a.size(), 10);
+    ASSERT_EQ(std::get<1>(a[9]), "seven");
+    soa_vector<int, std::string> b(5);
+    ASSERT_EQ(std::get<0>(b[4]), 0);
+    soa_vector<int, std::string> c{{1, "one"}, {2, "two"}};
+    ASSERT_EQ(std::get<1>(c.back()), "two");
+
+    soa_vector<int, std::string> copy(a);
+    ASSERT_TRUE(copy == a);
+    soa_vector<int, std::string> moved(std::move(copy));
+    ASSERT_TRUE(moved == a);
+    ASSERT_TRUE(copy.empty());
+    b = c;
+    ASSERT_TRUE(b == c);
+    ASSERT_TRUE(b != a);
+    b = std::move(moved);
+    ASSERT_TRUE(b == a);
+    swap(b, c);
+    ASSERT_EQ(b.size(), 2);
+    ASSERT_EQ(c.size(), 10);
+
+    // the argument refers to a row of the vector while it grows
+    c.shrink_to_fit();
+    c.push_back(c[0]);
+    ASSERT_EQ(std::get<1>(c.back()), "seven");
+}
+
+// a failing column leaves all the columns as they were
+void test_exception_safety(testing::Test*) {
+    tracked::live = 0;
+    {
+        soa_vector<std::string, tracked, int> s;
+        for (int i = 0; i < 100; ++i)
+            s.emplace_back(std::to_string(i), i, i);
+        s.shrink_to_fit();
+        const std::string* names = s.data<0>();
+
+        tracked::copies   = 0;
+        tracked::throw_at = 50;
+        ASSERT_THROW(s.emplace_back("new", 100, 100), std::runtime_error);
+        ASSERT_EQ(s.size(), 100);
+        ASSERT_EQ(s.capacity(), 100);
+        ASSERT_EQ(s.data<0>(), names);
+        ASSERT_EQ(tracked::live, 100);
+        ASSERT_EQ(s.column<0>()[99], "99");
+
+        tracked::copies   = 0;
+        tracked::throw_at = 0;
+        ASSERT_THROW(s.resize(200, {"x", tracked(1), 1}), std::runtime_error);
+        ASSERT_EQ(s.size(), 100);
+        ASSERT_EQ(tracked::live, 100);
+
+        s.reserve(200);
+        tracked::copies   = 3;
+        tracked::throw_at = 5;
+        ASSERT_THROW(s.resize(150, {"x", tracked(1), 1}), std::runtime_error);
+        ASSERT_EQ(s.size(), 100);
+        ASSERT_EQ(tracked::live, 100);
+        for (int i = 0; i < 100; ++i)
+            ASSERT_EQ(s.column<1>()[static_cast<std::size_t>(i)].value, i);
+        tracked::throw_at = -1;
+    }
+    ASSERT_EQ(tracked::live, 0);
+}
+
+} // end of unnamed namespace
+
+TEST(soa_vector, random_ops) {
+    test_random_ops(this);
+}
+
+TEST(soa_vector, columns) {
+    test_columns(this);
+}
+
+TEST(soa_vector, iterators) {
+    test_iterators(this);
+}
+
+TEST(soa_vector, sort) {
+    test_sort(this);
+}
+
+TEST(soa_vector, capacity) {
+    test_capacity(this);
+}
+
+TEST(soa_vector, constructor_and_assignment) {
+    test_constructor_and_assignment(this);
+}
+
+TEST(soa_vector, exception_safety) {
+    test_exception_safety(this);
+}
@@ -1,11 +1,25 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <vector>
+
 #include <tgp/split_buffer.h>
 
+#include "test_types.h"
+
 using namespace tgp;
 
 namespace {
 
+static_assert(can_bulk_value_construct_v<std::allocator<std::uint64_t>, std::uint64_t>);
+static_assert(can_bulk_fill_v<std::allocator<std::uint64_t>, std::uint64_t>);
+static_assert(can_bulk_copy_v<std::allocator<std::uint64_t>, std::vector<std::uint64_t>::iterator, std::uint64_t>);
+static_assert(can_bulk_copy_v<std::allocator<std::uint64_t>, const std::uint64_t*, std::uint64_t>);
+static_assert(!can_bulk_value_construct_v<constructing_allocator<std::uint64_t>, std::uint64_t>);
+static_assert(!can_bulk_fill_v<constructing_allocator<std::uint64_t>, std::uint64_t>);
+static_assert(!can_bulk_copy_v<constructing_allocator<std::uint64_t>, const std::uint64_t*, std::uint64_t>);
+static_assert(!can_bulk_copy_v<std::allocator<std::uint64_t>, const std::uint32_t*, std::uint64_t>);
+
 template<class C>
 void test_constructor_impl(testing::Test*) {
     using Alloc = typename C::allocator_type;
@@ -113,6 +127,57 @@ void test_emplace_front(testing::Test*) {
     }
 }
 
+template<class C>
+void test_construct_at_end_bulk(testing::Test*) {
+    using Alloc = typename C::allocator_type;
+    using T     = typename C::value_type;
+    using Sz    = typename C::size_type;
+    {
+        Alloc a;
+        C c(64, 0, a);
+        c.construct_at_end(static_cast<Sz>(16));
+        c.construct_at_end(static_cast<Sz>(16), T{0x0101010101010101});
+        c.construct_at_end(static_cast<Sz>(16), T{42});
+        std::vector<T> v(16, T{7});
+        c.construct_at_end(v.begin(), v.end());
+        ASSERT_EQ(c.begin_ + 64, c.end_);
+        for (Sz i = 0; i < 64; ++i) {
+            const T expected[] = {T{0}, T{0x0101010101010101}, T{42}, T{7}};
+            ASSERT_EQ(c.begin_[i], expected[i / 16]);
+        }
+        ASSERT_TRUE(c.invariants());
+    }
+}
+
+template<class C>
+void test_push_both_ends(testing::Test*) {
+    using Alloc = typename C::allocator_type;
+    {
+        Alloc a;
+        C c(a);
+        ASSERT_TRUE(c.invariants());
+        for (int i = 0; i < 100; ++i) {
+            c.push_back(i);
+            c.push_front(-i);
+            ASSERT_TRUE(c.invariants());
+        }
+        ASSERT_EQ(c.size(), 200);
+        ASSERT_EQ(c.begin_[0], -99);
+        ASSERT_EQ(c.end_[-1], 99);
+        c.pop_front();
+        c.pop_back();
+        ASSERT_EQ(c.size(), 198);
+        ASSERT_EQ(c.begin_[0], -98);
+        ASSERT_EQ(c.end_[-1], 98);
+
+        C other(4, 2, a);
+        other.emplace_back(1);
+        c.swap(other);
+        ASSERT_EQ(c.size(), 1);
+        ASSERT_EQ(other.size(), 198);
+    }
+}
+
 } // end of unnamed namespace
 
 TEST(split_buffer, constructor) {
@@ -137,4 +202,16 @@ TEST(split_buffer, emplace_back) {
 
 TEST(split_buffer, emplace_front) {
     test_emplace_front<split_buffer<int, std::allocator<int>&>>(this);
+}
+
+TEST(split_buffer, construct_at_end_bulk) {
+    test_construct_at_end_bulk<split_buffer<std::uint64_t, std::allocator<std::uint64_t>&>>(this);
+    constructing_allocator<std::uint64_t>::constructs = 0;
+    test_construct_at_end_bulk<split_buffer<std::uint64_t, constructing_allocator<std::uint64_t>&>>(this);
+    ASSERT_EQ(constructing_allocator<std::uint64_t>::constructs, 64);
+}
+
+TEST(split_buffer, push_both_ends) {
+    test_push_both_ends<split_buffer<int, std::allocator<int>&>>(this);
+    test_push_both_ends<split_buffer<int, std::allocator<int>>>(this);
 }
\ No newline at end of file
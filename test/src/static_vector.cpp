@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <tgp/static_vector.h>
+
+using namespace tgp;
+
+namespace {
+
+struct header {
+    std::uint32_t id;
+    std::uint16_t length;
+    std::uint16_t flags;
+};
+
+static_assert(std::is_trivially_copyable_v<static_vector<int, 8>>);
+static_assert(std::is_trivially_copyable_v<static_vector<header, 4>>);
+static_assert(!std::is_trivially_copyable_v<static_vector<std::string, 4>>);
+static_assert(std::is_trivially_destructible_v<static_vector<int, 8>>);
+
+constexpr int constant_sum() {
+    static_vector<int, 8> v{1, 2, 3};
+    v.insert(v.begin() + 1, 10);
+    v.erase(v.begin());
+    static_vector<int, 8> w = v;
+    w.push_back(4);
+    int sum = 0;
+    for (int x : w)
+        sum += x;
+    return sum;
+}
+
+static_assert(constant_sum() == 19);
+
+// the value is copied before the elements it refers to move
+constexpr bool constant_self_insert() {
+    static_vector<int, 8> v{1, 2, 3};
+    v.insert(v.begin(), 2, v[2]);
+    v.insert(v.begin() + 1, 1, v.back());
+    const int expected[] = {3, 3, 3, 1, 2, 3};
+    return std::ranges::equal(v, expected);
+}
+
+static_assert(constant_self_insert());
+
+template<class C>
+void expect_sequence(const C& c, std::initializer_list<typename C::value_type> expected) {
+    ASSERT_EQ(c.size(), expected.size());
+    std::size_t i = 0;
+    for (const auto& v : expected)
+        EXPECT_EQ(c[i++], v);
+}
+
+} // namespace
+
+TEST(static_vector, modifiers) {
+    static_vector<int, 8> v{1, 2, 3};
+    v.insert(v.begin() + 1, 2, 9);
+    expect_sequence(v, {1, 9, 9, 2, 3});
+    v.emplace(v.begin(), 0);
+    v.erase(v.begin() + 2, v.begin() + 4);
+    expect_sequence(v, {0, 1, 2, 3});
+    v.erase_unordered(v.begin());
+    expect_sequence(v, {3, 1, 2});
+    const std::vector<int> more{7, 8, 9};
+    v.insert(v.end() - 1, more.begin(), more.end());
+    expect_sequence(v, {3, 1, 7, 8, 9, 2});
+    ASSERT_EQ(erase_if(v, [](int x) { return x > 7; }), 2);
+    expect_sequence(v, {3, 1, 7, 2});
+    v.resize(6, 5);
+    expect_sequence(v, {3, 1, 7, 2, 5, 5});
+    v.assign({4, 5});
+    expect_sequence(v, {4, 5});
+    v.assign_range(std::views::iota(0, 8));
+    ASSERT_EQ(v.size(), 8);
+    ASSERT_EQ(v.erase_indices(std::vector<int>{0, 3, 7}), 3);
+    expect_sequence(v, {1, 2, 4, 5, 6});
+
+    static_vector<std::string, 4> s{"a", "b"};
+    s.insert(s.begin(), s.back());
+    s.insert(s.begin() + 1, std::string(32, 'x'));
+    expect_sequence(s, {"b", std::string(32, 'x'), "a", "b"});
+    static_vector<std::string, 4> t = s;
+    s.erase(s.begin());
+    t.swap(s);
+    expect_sequence(t, {std::string(32, 'x'), "a", "b"});
+    expect_sequence(s, {"b", std::string(32, 'x'), "a", "b"});
+
+    static_vector<std::string, 8> m{"0", "1", "2", "3", "4"};
+    const std::vector<std::string> xy{"x", "y"};
+    m.insert(m.begin() + 1, xy.begin(), xy.end());
+    expect_sequence(m, {"0", "x", "y", "1", "2", "3", "4"});
+
+    std::istringstream in("1 2 3");
+    static_vector<int, 4> r(from_range, std::views::istream<int>(in));
+    expect_sequence(r, {1, 2, 3});
+}
+
+TEST(static_vector, overflow) {
+    static_vector<std::string, 3> v{"a", "b", "c"};
+    ASSERT_THROW(v.push_back("d"), std::bad_alloc);
+    ASSERT_THROW(v.insert(v.begin(), 2, "e"), std::bad_alloc);
+    ASSERT_THROW(v.resize(4), std::bad_alloc);
+    expect_sequence(v, {"a", "b", "c"});
+    ASSERT_EQ(v.try_push_back("d"), nullptr);
+    ASSERT_EQ(v.try_emplace_back(3, 'x'), nullptr);
+    ASSERT_EQ(v.size(), 3);
+
+    v.pop_back();
+    std::string* p = v.try_emplace_back(3, 'x');
+    ASSERT_EQ(p, &v.back());
+    ASSERT_EQ(*p, "xxx");
+
+    static_vector<int, 4> w;
+    const std::vector<int> five{1, 2, 3, 4, 5};
+    ASSERT_THROW(w.append_range(five), std::bad_alloc);
+    ASSERT_TRUE(w.empty());
+    ASSERT_THROW(w.reserve(5), std::bad_alloc);
+}
+
+TEST(static_vector, memcpy) {
+    static_vector<header, 4> a;
+    a.push_back({1, 20, 0});
+    a.push_back({2, 40, 1});
+    static_vector<header, 4> b;
+    std::memcpy(static_cast<void*>(&b), &a, sizeof(a));
+    ASSERT_EQ(b.size(), 2);
+    ASSERT_EQ(b[1].id, 2);
+    ASSERT_EQ(b[1].length, 40);
+
+    static_vector<std::uint8_t, 16> bytes;
+    bytes.append_n(16, [](std::uint8_t* out, std::size_t n) {
+        for (std::size_t i = 0; i < n / 2; ++i)
+            out[i] = static_cast<std::uint8_t>(i);
+        return n / 2;
+    });
+    ASSERT_EQ(bytes.size(), 8);
+    ASSERT_EQ(bytes.back(), 7);
+}
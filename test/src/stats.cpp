@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <tgp/execution.h>
+#include <tgp/stats.h>
+#include <tgp/tracking_allocator.h>
+#include <tgp/vector.h>
+
+using namespace tgp;
+
+namespace {
+
+// growing by push_back allocates once per capacity and relocates everything held before each growth
+void test_vector_counters(testing::Test*) {
+    reset_stats();
+    vector<std::uint64_t> v;
+    v.set_stats_tag("stats.vector_counters");
+    std::uint64_t allocations = 0, elements = 0, peak = 0;
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        if (v.size() == v.capacity()) {
+            ++allocations;
+            elements += v.size();
+        }
+        v.push_back(i);
+        peak = std::max<std::uint64_t>(peak, v.capacity() * sizeof(std::uint64_t));
+    }
+    const stats_counters c = v.stats();
+    ASSERT_EQ(c.allocations, allocations);
+    ASSERT_EQ(c.relocations, allocations - 1);
+    ASSERT_EQ(c.elements_moved, elements);
+    ASSERT_EQ(c.bytes_moved, elements * sizeof(std::uint64_t));
+    ASSERT_EQ(c.peak_capacity, peak);
+    ASSERT_EQ(c.wasted_capacity, (v.capacity() - v.size()) * sizeof(std::uint64_t));
+
+    v.shrink_to_fit();
+    ASSERT_EQ(v.stats().allocations, allocations + 1);
+    ASSERT_EQ(v.stats().wasted_capacity, 0);
+}
+
+// a parallel assign builds into a fresh buffer, which the vector and its tag count like any other
+void test_parallel_assign(testing::Test*) {
+    reset_stats();
+    {
+        vector<std::uint64_t> v(100, 1);
+        v.set_stats_tag("stats.parallel_assign");
+        v.assign(parallel_policy{2, 1024}, 5000, 7);
+        ASSERT_EQ(v.size(), 5000);
+        ASSERT_EQ(v.stats().allocations, 2);
+        ASSERT_EQ(v.stats().peak_capacity, 5000 * sizeof(std::uint64_t));
+        ASSERT_EQ(v.stats().wasted_capacity, 0);
+    }
+    const stats_snapshot s = snapshot_stats();
+    const auto it = std::find_if(s.tags.begin(), s.tags.end(),
+                                 [](const auto& t) { return t.first == "stats.parallel_assign"; });
+    ASSERT_NE(it, s.tags.end());
+    ASSERT_EQ(it->second.allocations, 1);
+    ASSERT_EQ(it->second.peak_capacity, 5000 * sizeof(std::uint64_t));
+    ASSERT_EQ(s.global.allocations, 2);
+}
+
+// tags add up the counters of every container carrying them, the global record those of all containers
+void test_tags(testing::Test*) {
+    reset_stats();
+    {
+        vector<std::string> a;
+        vector<std::string> b;
+        vector<std::string> untagged;
+        a.set_stats_tag("stats.tags");
+        b.set_stats_tag("stats.tags");
+        a.reserve(10);
+        b.reserve(20);
+        untagged.reserve(40);
+        a.push_back("one");
+
+        // the copy is not tagged
+        const vector<std::string> copy(a);
+        ASSERT_EQ(copy.stats().allocations, 1);
+    }
+    const stats_snapshot s = snapshot_stats();
+    const auto it = std::find_if(s.tags.begin(), s.tags.end(), [](const auto& t) { return t.first == "stats.tags"; });
+    ASSERT_NE(it, s.tags.end());
+    ASSERT_EQ(it->second.allocations, 2);
+    ASSERT_EQ(it->second.relocations, 0);
+    ASSERT_EQ(it->second.peak_capacity, 20 * sizeof(std::string));
+    ASSERT_EQ(it->second.wasted_capacity, (10 + 20 - 1) * sizeof(std::string));
+    ASSERT_EQ(s.global.allocations, 4);
+    ASSERT_EQ(s.global.peak_capacity, 40 * sizeof(std::string));
+
+    std::ostringstream os;
+    dump_stats(os);
+    ASSERT_NE(os.str().find("stats.tags: allocations 2"), std::string::npos);
+    ASSERT_NE(os.str().find("<global>: allocations 4"), std::string::npos);
+
+    reset_stats();
+    ASSERT_EQ(snapshot_stats().global.allocations, 0);
+}
+
+void test_tracking_allocator(testing::Test*) {
+    size_histogram histogram;
+    {
+        vector<std::uint64_t, tracking_allocator<std::allocator<std::uint64_t>>> v{
+            tracking_allocator<std::allocator<std::uint64_t>>(histogram)};
+        v.reserve(1);
+        v.reserve(100);
+        v.reserve(1000);
+    }
+    ASSERT_EQ(histogram.total_count(), 3);
+    ASSERT_EQ(histogram.total_bytes(), 1101 * sizeof(std::uint64_t));
+    ASSERT_EQ(histogram.count(size_histogram::bucket_of(8)), 1);
+    ASSERT_EQ(histogram.count(size_histogram::bucket_of(800)), 1);
+    ASSERT_EQ(histogram.count(size_histogram::bucket_of(8000)), 1);
+    ASSERT_EQ(size_histogram::bucket_of(0), 0);
+    ASSERT_EQ(size_histogram::bucket_of(1000), size_histogram::bucket_of(1023));
+    ASSERT_NE(size_histogram::bucket_of(1023), size_histogram::bucket_of(1024));
+
+    std::ostringstream os;
+    histogram.dump(os);
+    ASSERT_NE(os.str().find("[512, 1024): 1"), std::string::npos);
+    ASSERT_NE(os.str().find("total: 3 allocations"), std::string::npos);
+}
+
+} // end of unnamed namespace
+
+TEST(stats, vector_counters) {
+    test_vector_counters(this);
+}
+
+TEST(stats, tags) {
+    test_tags(this);
+}
+
+TEST(stats, parallel_assign) {
+    test_parallel_assign(this);
+}
+
+TEST(stats, tracking_allocator) {
+    test_tracking_allocator(this);
+}
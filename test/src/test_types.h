@@ -0,0 +1,87 @@
+#ifndef TSTL_TEST_SRC_TEST_TYPES_H
+#define TSTL_TEST_SRC_TEST_TYPES_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+// fixtures shared by the container tests, each test file gets its own counters
+namespace {
+
+// counts live instances across threads, and throws from the copy with the given serial number
+struct tracked {
+    static inline std::atomic<int> live{0};
+    static inline std::atomic<int> copies{0};
+    static inline int throw_at = -1;
+
+    int value = 0;
+
+    tracked() { ++live; }
+    tracked(int v) : value(v) { ++live; }
+    tracked(const tracked& other) : value(other.value) {
+        if (copies++ == throw_at)
+            throw std::runtime_error("tracked");
+        ++live;
+    }
+    tracked& operator=(const tracked&) = default;
+    ~tracked() { --live; }
+};
+
+// the blocks taken by a counting_allocator of any type, and those not given back yet
+struct allocation_counter {
+    static inline std::size_t allocations = 0;
+    static inline std::size_t live        = 0;
+};
+
+// counts the blocks taken and given back through it and any rebound copy
+template<class T>
+struct counting_allocator : std::allocator<T>, allocation_counter {
+    using value_type = T;
+
+    template<class U>
+    struct rebind { using other = counting_allocator<U>; };
+
+    counting_allocator() = default;
+
+    template<class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const std::size_t n) {
+        ++allocations;
+        ++live;
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate(T* p, const std::size_t n) noexcept {
+        --live;
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+// an allocator with its own construct, which must keep the containers off the bulk paths
+template<class T>
+struct constructing_allocator : counting_allocator<T> {
+    using value_type = T;
+
+    template<class U>
+    struct rebind { using other = constructing_allocator<U>; };
+
+    static inline std::size_t constructs = 0;
+
+    constructing_allocator() = default;
+
+    template<class U>
+    constructing_allocator(const constructing_allocator<U>&) noexcept {}
+
+    template<class U, class... Args>
+    void construct(U* p, Args&&... args) {
+        ++constructs;
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+
+} // end of unnamed namespace
+
+#endif // end of TSTL_TEST_SRC_TEST_TYPES_H
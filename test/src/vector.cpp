@@ -0,0 +1,778 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <tgp/execution.h>
+#include <tgp/huge_page_allocator.h>
+#include <tgp/mremap_allocator.h>
+#include <tgp/vector.h>
+
+#include "test_types.h"
+
+using namespace tgp;
+
+namespace {
+
+// a 32-byte handle whose move constructor is not trivial, counting how often elements get moved
+template<bool Relocatable>
+struct handle {
+    static inline int moves = 0;
+
+    int   value = 0;
+    void* resource[3] = {};
+
+    handle() = default;
+    handle(int v) : value(v) {}
+    handle(const handle&) = default;
+    handle(handle&& other) noexcept : value(other.value) { ++moves; other.value = -1; }
+    handle& operator=(const handle&) = default;
+    handle& operator=(handle&& other) noexcept { value = other.value; ++moves; other.value = -1; return *this; }
+    ~handle() {}
+
+    friend bool operator==(const handle& lhs, int rhs) { return lhs.value == rhs; }
+};
+
+using relocatable_handle = handle<true>;
+using movable_handle     = handle<false>;
+
+// hands out blocks from one static buffer, the last block may grow in place and every block has some slack
+template<class T>
+struct bump_allocator {
+    using value_type = T;
+
+    alignas(std::max_align_t) static inline unsigned char buffer[1 << 16];
+    static inline std::size_t used = 0;
+    static inline std::size_t expansions = 0;
+
+    bump_allocator() = default;
+
+    template<class U>
+    bump_allocator(const bump_allocator<U>&) noexcept {}
+
+    allocation_result<T*> allocate_at_least(std::size_t n) {
+        n += 3;
+        if (used + n * sizeof(T) > sizeof(buffer))
+            throw std::bad_alloc();
+        T* p = reinterpret_cast<T*>(buffer + used);
+        used += n * sizeof(T);
+        return {p, n};
+    }
+
+    T* allocate(std::size_t n) {
+        return allocate_at_least(n).ptr;
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if (reinterpret_cast<unsigned char*>(p + n) == buffer + used)
+            used -= n * sizeof(T);
+    }
+
+    std::size_t expand_in_place(T* p, std::size_t n, std::size_t new_n) noexcept {
+        if (reinterpret_cast<unsigned char*>(p + n) != buffer + used || used + (new_n - n) * sizeof(T) > sizeof(buffer))
+            return 0;
+        used += (new_n - n) * sizeof(T);
+        ++expansions;
+        return new_n;
+    }
+
+    friend bool operator==(const bump_allocator&, const bump_allocator&) { return true; }
+};
+
+} // end of unnamed namespace
+
+template<>
+struct tgp::is_trivially_relocatable<relocatable_handle> : std::true_type {};
+
+static_assert(is_trivially_relocatable_v<int>);
+static_assert(is_trivially_relocatable_v<std::unique_ptr<int>>);
+static_assert(is_trivially_relocatable_v<relocatable_handle>);
+static_assert(!is_trivially_relocatable_v<movable_handle>);
+static_assert(is_trivially_allocator_relocatable_v<std::allocator<relocatable_handle>, relocatable_handle>);
+
+static_assert(double_growth::recommend(10, 11, 100, 4) == 20);
+static_assert(double_growth::recommend(60, 61, 100, 4) == 100);
+static_assert(one_and_half_growth::recommend(10, 11, 100, 4) == 15);
+static_assert(one_and_half_growth::recommend(1, 2, 100, 4) == 2);
+static_assert(page_rounded_growth<>::recommend(1000, 1001, 1 << 20, 8) == 2048);
+static_assert(page_rounded_growth<>::recommend(10, 11, 1 << 20, 8) == 20);
+static_assert(size_class_rounded_growth<>::recommend(10, 11, 1 << 20, 4) == 20);
+static_assert(size_class_rounded_growth<>::recommend(20, 21, 1 << 20, 4) == 40);
+static_assert(size_class_rounded_growth<one_and_half_growth>::recommend(100, 101, 1 << 20, 4) == 160);
+static_assert(malloc_size_class(129) == 160);
+static_assert(malloc_size_class(4097) == 5120);
+
+static_assert(can_bulk_value_construct_v<std::allocator<std::uint64_t>, std::uint64_t>);
+static_assert(can_bulk_fill_v<std::allocator<std::uint64_t>, std::uint64_t>);
+static_assert(can_bulk_copy_v<std::allocator<std::uint64_t>, const std::uint64_t*, std::uint64_t>);
+static_assert(!can_bulk_value_construct_v<std::allocator<relocatable_handle>, relocatable_handle>);
+static_assert(!can_bulk_fill_v<std::allocator<relocatable_handle>, relocatable_handle>);
+static_assert(!can_bulk_value_construct_v<constructing_allocator<std::uint64_t>, std::uint64_t>);
+
+namespace {
+
+template<class C>
+void expect_sequence(const C& c, std::initializer_list<int> expected) {
+    ASSERT_EQ(c.size(), expected.size());
+    auto it = expected.begin();
+    for (auto& e : c)
+        ASSERT_EQ(e, *it++);
+}
+
+template<class C>
+void test_relocation_on_growth(testing::Test*) {
+    using T = typename C::value_type;
+    {
+        C c;
+        T::moves = 0;
+        for (int i = 0; i < 100; ++i)
+            c.emplace_back(i);
+        ASSERT_EQ(c.size(), 100);
+        for (int i = 0; i < 100; ++i)
+            ASSERT_EQ(c[i], i);
+        if constexpr (is_trivially_relocatable_v<T>) {
+            ASSERT_EQ(T::moves, 0);
+        } else {
+            ASSERT_GT(T::moves, 0);
+        }
+    }
+    {
+        C c;
+        for (int i = 0; i < 5; ++i)
+            c.emplace_back(i);
+        c.reserve(64);
+        ASSERT_GE(c.capacity(), 64);
+        expect_sequence(c, {0, 1, 2, 3, 4});
+    }
+}
+
+template<class C>
+void test_relocation_on_emplace(testing::Test*) {
+    using T = typename C::value_type;
+    {
+        C c;
+        c.reserve(8);
+        for (int i = 0; i < 5; ++i)
+            c.emplace_back(i);
+        T::moves = 0;
+        c.emplace(c.begin() + 2, 42);
+        expect_sequence(c, {0, 1, 42, 2, 3, 4});
+        if constexpr (is_trivially_relocatable_v<T>) {
+            ASSERT_EQ(T::moves, 0);
+        }
+    }
+    {
+        C c;
+        for (int i = 0; i < 4; ++i)
+            c.emplace_back(i);
+        c.shrink_to_fit();
+        c.emplace(c.begin() + 1, 42);
+        expect_sequence(c, {0, 42, 1, 2, 3});
+    }
+    {
+        C c;
+        c.reserve(8);
+        for (int i = 0; i < 4; ++i)
+            c.emplace_back(i);
+        c.emplace(c.begin(), c[3]);
+        expect_sequence(c, {3, 0, 1, 2, 3});
+    }
+}
+
+template<class C>
+void test_relocation_on_insert(testing::Test*) {
+    using T = typename C::value_type;
+    {
+        C c;
+        c.reserve(16);
+        for (int i = 0; i < 4; ++i)
+            c.emplace_back(i);
+        c.insert(c.begin() + 1, 3, c[2]);
+        expect_sequence(c, {0, 2, 2, 2, 1, 2, 3});
+    }
+    {
+        C c;
+        c.reserve(16);
+        for (int i = 0; i < 4; ++i)
+            c.emplace_back(i);
+        const T src[] = {7, 8, 9};
+        T::moves = 0;
+        c.insert(c.begin() + 2, std::begin(src), std::end(src));
+        expect_sequence(c, {0, 1, 7, 8, 9, 2, 3});
+        if constexpr (is_trivially_relocatable_v<T>) {
+            ASSERT_EQ(T::moves, 0);
+        }
+    }
+    {
+        C c;
+        for (int i = 0; i < 4; ++i)
+            c.emplace_back(i);
+        c.shrink_to_fit();
+        const T src[] = {7, 8};
+        c.insert(c.begin() + 3, std::begin(src), std::end(src));
+        expect_sequence(c, {0, 1, 2, 7, 8, 3});
+    }
+}
+
+template<class C>
+void test_relocation_on_erase(testing::Test*) {
+    using T = typename C::value_type;
+    {
+        C c;
+        for (int i = 0; i < 6; ++i)
+            c.emplace_back(i);
+        T::moves = 0;
+        auto it = c.erase(c.begin() + 1);
+        ASSERT_EQ(*it, 2);
+        expect_sequence(c, {0, 2, 3, 4, 5});
+        it = c.erase(c.begin() + 1, c.begin() + 3);
+        ASSERT_EQ(*it, 4);
+        expect_sequence(c, {0, 4, 5});
+        it = c.erase(c.begin() + 1, c.begin() + 1);
+        ASSERT_EQ(*it, 4);
+        expect_sequence(c, {0, 4, 5});
+        if constexpr (is_trivially_relocatable_v<T>) {
+            ASSERT_EQ(T::moves, 0);
+        }
+    }
+}
+
+template<class C>
+void test_relocation_on_scattered_erase(testing::Test*) {
+    using T = typename C::value_type;
+    {
+        C c;
+        for (int i = 0; i < 10; ++i)
+            c.emplace_back(i);
+        T::moves = 0;
+        auto it = c.erase_unordered(c.begin() + 2);
+        ASSERT_EQ(*it, 9);
+        expect_sequence(c, {0, 1, 9, 3, 4, 5, 6, 7, 8});
+        it = c.erase_unordered(c.end() - 1);
+        ASSERT_TRUE(it == c.end());
+        expect_sequence(c, {0, 1, 9, 3, 4, 5, 6, 7});
+        if constexpr (is_trivially_relocatable_v<T>) {
+            ASSERT_EQ(T::moves, 0);
+        } else {
+            ASSERT_EQ(T::moves, 1);
+        }
+
+        T::moves = 0;
+        const std::size_t indices[] = {0, 3, 4, 7};
+        ASSERT_EQ(c.erase_indices(indices), 4);
+        expect_sequence(c, {1, 9, 5, 6});
+        if constexpr (is_trivially_relocatable_v<T>) {
+            ASSERT_EQ(T::moves, 0);
+        } else {
+            ASSERT_EQ(T::moves, 4);
+        }
+        ASSERT_EQ(c.erase_indices(std::vector<int>{}), 0);
+        ASSERT_EQ(c.erase_indices(std::vector<int>{3}), 1);
+        expect_sequence(c, {1, 9, 5});
+    }
+}
+
+template<class C>
+void test_bulk_construction(testing::Test*) {
+    using T = typename C::value_type;
+    {
+        C c(100);
+        ASSERT_EQ(c.size(), 100);
+        for (auto& e : c)
+            ASSERT_EQ(e, T{0});
+    }
+    {
+        C c(100, T{0xabababababababab});
+        for (auto& e : c)
+            ASSERT_EQ(e, T{0xabababababababab});
+        C d(100, T{12345});
+        for (auto& e : d)
+            ASSERT_EQ(e, T{12345});
+    }
+    {
+        C c(100, T{9});
+        C d(c);
+        ASSERT_EQ(d.size(), 100);
+        for (auto& e : d)
+            ASSERT_EQ(e, T{9});
+    }
+    {
+        C c(10, T{3});
+        c.resize(20);
+        c.resize(c.capacity() + 10, T{4});
+        ASSERT_EQ(c[9], T{3});
+        ASSERT_EQ(c[10], T{0});
+        ASSERT_EQ(c[19], T{0});
+        ASSERT_EQ(c[20], T{4});
+        ASSERT_EQ(c.back(), T{4});
+    }
+}
+
+template<class Policy>
+void test_growth_policy(testing::Test*) {
+    using C = vector<int, std::allocator<int>, Policy>;
+    {
+        C c;
+        std::size_t cap = c.capacity();
+        for (int i = 0; i < 1000; ++i) {
+            c.push_back(i);
+            if (c.capacity() != cap) {
+                ASSERT_EQ(c.capacity(), Policy::recommend(cap, c.size(), c.max_size(), sizeof(int)));
+                cap = c.capacity();
+            }
+        }
+        c.insert(c.end(), static_cast<std::size_t>(c.capacity() - c.size() + 1), 7);
+        ASSERT_EQ(c.capacity(), Policy::recommend(cap, c.size(), c.max_size(), sizeof(int)));
+    }
+    {
+        C c(10, 1);
+        const int src[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        c.assign(std::begin(src), std::end(src));
+        ASSERT_EQ(c.capacity(), Policy::recommend(10, 12, c.max_size(), sizeof(int)));
+        ASSERT_EQ(c.size(), 12);
+        ASSERT_EQ(c.back(), 12);
+    }
+}
+
+// throws from its default constructor once the countdown reaches zero
+struct throwing_default {
+    static inline int countdown = -1;
+
+    std::string value = "init";
+
+    throwing_default() {
+        if (countdown >= 0 && countdown-- == 0)
+            throw std::runtime_error("throwing_default");
+    }
+    throwing_default(const throwing_default&) = default;
+    throwing_default(throwing_default&&) = default;
+};
+
+} // end of unnamed namespace
+
+TEST(vector, default_init) {
+    static_assert(can_skip_default_construct_v<std::allocator<char>, char>);
+    static_assert(!can_skip_default_construct_v<std::allocator<std::string>, std::string>);
+    {
+        vector<char> c(64, 'x');
+        c.resize(32);
+        c.resize(64, default_init);
+        ASSERT_EQ(c.size(), 64);
+        c.resize(1000, default_init);
+        ASSERT_EQ(c.size(), 1000);
+        ASSERT_EQ(c[31], 'x');
+        vector<char> d(1000, default_init);
+        ASSERT_EQ(d.size(), 1000);
+    }
+    {
+        vector<std::string> c(3, default_init);
+        c.resize(5, default_init);
+        ASSERT_EQ(c.size(), 5);
+        for (auto& e : c)
+            ASSERT_TRUE(e.empty());
+    }
+}
+
+TEST(vector, default_init_strong_exception_guarantee) {
+    vector<throwing_default> c(4);
+    c.reserve(10);
+    for (int grow : {2, 20}) {
+        throwing_default::countdown = 1;
+        const auto cap = c.capacity();
+        ASSERT_THROW(c.resize(c.size() + grow, default_init), std::runtime_error);
+        ASSERT_EQ(c.size(), 4);
+        ASSERT_EQ(c.capacity(), cap);
+        for (auto& e : c)
+            ASSERT_EQ(e.value, "init");
+    }
+    throwing_default::countdown = -1;
+}
+
+TEST(vector, bulk_construction) {
+    test_bulk_construction<vector<std::uint64_t>>(this);
+    constructing_allocator<std::uint64_t>::constructs = 0;
+    test_bulk_construction<vector<std::uint64_t, constructing_allocator<std::uint64_t>>>(this);
+    ASSERT_GT(constructing_allocator<std::uint64_t>::constructs, 0);
+}
+
+TEST(vector, growth_policy) {
+    test_growth_policy<double_growth>(this);
+    test_growth_policy<one_and_half_growth>(this);
+    test_growth_policy<page_rounded_growth<>>(this);
+    test_growth_policy<size_class_rounded_growth<>>(this);
+}
+
+TEST(vector, allocate_at_least) {
+    vector<int, bump_allocator<int>> c;
+    c.reserve(10);
+    ASSERT_EQ(c.capacity(), 13);
+    vector<int, bump_allocator<int>> d(10, 1);
+    ASSERT_EQ(d.capacity(), 13);
+}
+
+TEST(vector, expand_in_place) {
+    bump_allocator<int>::expansions = 0;
+    vector<int, bump_allocator<int>> c;
+    c.push_back(0);
+    const int* data = c.data();
+    for (int i = 1; i < 1000; ++i)
+        c.push_back(i);
+    c.resize(2000, 7);
+    c.reserve(3000);
+    ASSERT_EQ(c.data(), data);
+    ASSERT_GE(c.capacity(), 3000);
+    ASSERT_GT(bump_allocator<int>::expansions, 0);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(c[i], i);
+    ASSERT_EQ(c[1999], 7);
+}
+
+TEST(vector, mremap_allocator) {
+    vector<std::uint64_t, mremap_allocator<std::uint64_t>> c;
+    for (std::uint64_t i = 0; i < (1 << 20); ++i)
+        c.push_back(i);
+    ASSERT_EQ(c.capacity() * sizeof(std::uint64_t) % page_size(), 0);
+    c.resize(c.capacity() + 1, c[3]);
+    c.emplace_back(c[5]);
+    c.reserve(c.capacity() * 4);
+    for (std::uint64_t i = 0; i < (1 << 20); ++i)
+        ASSERT_EQ(c[i], i);
+    ASSERT_EQ(c[1 << 20], 3);
+    ASSERT_EQ(c.back(), 5);
+}
+
+TEST(vector, huge_page_allocator) {
+    using alloc = huge_page_allocator<float, (1 << 20)>;
+    vector<float, alloc> c;
+    for (int i = 0; i < 1000; ++i)
+        c.push_back(static_cast<float>(i));
+    ASSERT_EQ(c.capacity(), 1024);
+
+    // reserving maps address space but commits nothing
+    c.reserve(std::size_t(1) << 24);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(c.data()) % huge_page_size, 0);
+    ASSERT_EQ(c.capacity() * sizeof(float) % huge_page_size, 0);
+    const std::size_t last_page = (c.capacity() * sizeof(float) - 1) / page_size() * page_size();
+    unsigned char resident = 1;
+    ASSERT_EQ(::mincore(reinterpret_cast<char*>(c.data()) + last_page, page_size(), &resident), 0);
+    ASSERT_EQ(resident & 1, 0);
+
+    // a page mapped right behind the buffer keeps it from growing in place, the moved one is still aligned
+    char* const behind = reinterpret_cast<char*>(c.data() + c.capacity());
+    void* const blocker = ::mmap(behind, page_size(), PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                                 -1, 0);
+    ASSERT_EQ(blocker, behind);
+    const float* const before = c.data();
+    c.resize(c.capacity() + 1, 2.5f);
+    ASSERT_NE(c.data(), before);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(c.data()) % huge_page_size, 0);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(c[i], static_cast<float>(i));
+    ASSERT_EQ(c.back(), 2.5f);
+    ::munmap(blocker, page_size());
+}
+
+TEST(vector, huge_page_allocator_populate) {
+    using alloc = huge_page_allocator<float, (1 << 20), true>;
+    vector<float, alloc> c;
+    c.reserve(huge_page_size / sizeof(float));
+    ASSERT_EQ(c.capacity() * sizeof(float), huge_page_size);
+
+    // keep the address space behind the buffer free, so that it grows in place
+    char* const behind = reinterpret_cast<char*>(c.data() + c.capacity());
+    void* const claim = ::mmap(behind, huge_page_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                               -1, 0);
+    if (claim != behind)
+        GTEST_SKIP() << "the address space behind the buffer is taken";
+    ::munmap(claim, huge_page_size);
+    const float* const before = c.data();
+    c.reserve(2 * huge_page_size / sizeof(float));
+    ASSERT_EQ(c.data(), before);
+
+    // the grown tail is committed before it is first written
+    const std::size_t pages = huge_page_size / page_size();
+    std::vector<unsigned char> resident(pages);
+    ASSERT_EQ(::mincore(behind, huge_page_size, resident.data()), 0);
+    ASSERT_EQ(std::count_if(resident.begin(), resident.end(), [](unsigned char r) { return (r & 1) != 0; }),
+              static_cast<std::ptrdiff_t>(pages));
+}
+
+TEST(vector, parallel_construction) {
+    // small chunks, so that a few thousand elements take all four threads
+    const parallel_policy policy{4, 1024};
+    {
+        vector<int> c(policy, 100000, 7);
+        ASSERT_EQ(c.size(), 100000);
+        ASSERT_EQ(std::count(c.begin(), c.end(), 7), 100000);
+        c.resize(policy, 300000);
+        ASSERT_EQ(c[99999], 7);
+        ASSERT_EQ(c[100000], 0);
+        c.resize(policy, 400000, c[5]);
+        ASSERT_EQ(c.back(), 7);
+        vector<int> d(policy, 50000);
+        ASSERT_EQ(std::count(d.begin(), d.end(), 0), 50000);
+
+        std::vector<int> source(123457);
+        for (std::size_t i = 0; i < source.size(); ++i)
+            source[i] = static_cast<int>(i);
+        c.assign(policy, source.begin(), source.end());
+        ASSERT_TRUE(std::equal(c.begin(), c.end(), source.begin(), source.end()));
+        c.assign(policy, 10, c[3]);
+        ASSERT_EQ(c.size(), 10);
+        ASSERT_EQ(c.back(), 3);
+    }
+    {
+        // a throwing chunk unwinds all the others
+        tracked::copies = 0;
+        tracked::throw_at = 30000;
+        ASSERT_THROW(vector<tracked>(policy, 50000, tracked(1)), std::runtime_error);
+        ASSERT_EQ(tracked::live, 0);
+
+        vector<tracked> c(10, tracked(2));
+        tracked::copies = 0;
+        ASSERT_THROW(c.resize(policy, 50000, tracked(3)), std::runtime_error);
+        ASSERT_EQ(c.size(), 10);
+        ASSERT_EQ(tracked::live, 10);
+
+        // assign builds into a fresh buffer, so the old elements stay
+        tracked::copies = 0;
+        ASSERT_THROW(c.assign(policy, 50000, tracked(4)), std::runtime_error);
+        ASSERT_EQ(c.size(), 10);
+        ASSERT_EQ(c[9].value, 2);
+        ASSERT_EQ(tracked::live, 10);
+        tracked::throw_at = -1;
+        c.assign(policy, 50000, c[0]);
+        ASSERT_EQ(c.size(), 50000);
+        ASSERT_EQ(c[49999].value, 2);
+    }
+}
+
+TEST(vector, parallel_chunks_at_page_boundaries) {
+    struct element {
+        char bytes[24];
+    };
+    const std::size_t page = page_size();
+    const std::size_t n = 100 * page / sizeof(element) + 7;
+    std::allocator<element> alloc;
+    element* const first = alloc.allocate(n);
+    // starts off a page boundary, so the first and last chunks take the partial pages
+    element* const begin = first + 1;
+    std::mutex mutex;
+    std::vector<std::pair<std::size_t, std::size_t>> chunks;
+    parallel_uninitialized_construct(parallel_policy{4, 1}, alloc, begin, n - 1, [&](element* p, std::size_t m) {
+        std::lock_guard<std::mutex> lock(mutex);
+        chunks.emplace_back(static_cast<std::size_t>(p - begin), m);
+    });
+    alloc.deallocate(first, n);
+
+    std::sort(chunks.begin(), chunks.end());
+    ASSERT_EQ(chunks.size(), 4);
+    std::size_t next = 0;
+    for (const auto& [offset, count] : chunks) {
+        ASSERT_EQ(offset, next);
+        next = offset + count;
+        if (offset > 0) {
+            // the first element starting on or after a page boundary
+            const auto address = reinterpret_cast<std::uintptr_t>(begin + offset);
+            ASSERT_LT(address % page, sizeof(element));
+        }
+    }
+    ASSERT_EQ(next, n - 1);
+}
+
+TEST(vector, relocation_on_growth) {
+    test_relocation_on_growth<vector<relocatable_handle>>(this);
+    test_relocation_on_growth<vector<movable_handle>>(this);
+}
+
+TEST(vector, relocation_on_emplace) {
+    test_relocation_on_emplace<vector<relocatable_handle>>(this);
+    test_relocation_on_emplace<vector<movable_handle>>(this);
+}
+
+TEST(vector, relocation_on_insert) {
+    test_relocation_on_insert<vector<relocatable_handle>>(this);
+    test_relocation_on_insert<vector<movable_handle>>(this);
+}
+
+TEST(vector, relocation_on_erase) {
+    test_relocation_on_erase<vector<relocatable_handle>>(this);
+    test_relocation_on_erase<vector<movable_handle>>(this);
+}
+
+TEST(vector, relocation_on_scattered_erase) {
+    test_relocation_on_scattered_erase<vector<relocatable_handle>>(this);
+    test_relocation_on_scattered_erase<vector<movable_handle>>(this);
+}
+
+TEST(vector, relocation_of_non_trivial_type) {
+    vector<std::string> c;
+    for (int i = 0; i < 20; ++i)
+        c.emplace_back(std::to_string(i) + std::string(32, 'x'));
+    c.erase(c.begin() + 3);
+    c.emplace(c.begin() + 5, "y");
+    ASSERT_EQ(c.size(), 20);
+    ASSERT_EQ(c[3], std::to_string(4) + std::string(32, 'x'));
+    ASSERT_EQ(c[5], "y");
+
+    vector<std::string> d{"0", "1", "2", "3", "4"};
+    d.reserve(16);
+    const std::string* data = d.data();
+    const std::vector<std::string> xy{"x", "y"};
+    d.insert(d.begin() + 1, xy.begin(), xy.begin() + 1);
+    d.insert_range(d.begin() + 1, xy);
+    ASSERT_EQ(d.data(), data);
+    ASSERT_EQ(d, (vector<std::string>{"0", "x", "y", "x", "1", "2", "3", "4"}));
+}
+
+TEST(vector, resize_and_overwrite) {
+    struct point { int x, y; };
+    static_assert(is_implicit_lifetime_v<point>);
+    static_assert(is_implicit_lifetime_v<std::uint8_t>);
+    static_assert(!is_implicit_lifetime_v<std::string>);
+
+    vector<point> c(3, point{1, 2});
+    c.resize_and_overwrite(100, [](point* p, std::size_t n) {
+        EXPECT_EQ(p[2].y, 2);
+        for (std::size_t i = 3; i < n; ++i)
+            p[i] = point{static_cast<int>(i), 0};
+        return n - 10;
+    });
+    ASSERT_EQ(c.size(), 90);
+    ASSERT_GE(c.capacity(), 100);
+    ASSERT_EQ(c[0].x, 1);
+    ASSERT_EQ(c[89].x, 89);
+
+    c.resize_and_overwrite(2, [](point*, std::size_t n) { return n; });
+    ASSERT_EQ(c.size(), 2);
+    ASSERT_EQ(c[1].y, 2);
+}
+
+TEST(vector, append_n) {
+    vector<std::uint8_t> c;
+    const std::uint8_t* data = nullptr;
+    for (int round = 0; round < 100; ++round) {
+        c.append_n(64, [round](std::uint8_t* out, std::size_t max_n) {
+            EXPECT_EQ(max_n, 64);
+            for (int i = 0; i < round % 8; ++i)
+                out[i] = static_cast<std::uint8_t>(round);
+            return round % 8;
+        });
+        // the room asked for is there, so appending less never grows
+        if (c.capacity() - c.size() >= 64) {
+            data = c.data();
+            c.append_n(64, [](std::uint8_t*, std::size_t) { return 0; });
+            ASSERT_EQ(c.data(), data);
+        }
+    }
+    std::size_t pos = 0;
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < round % 8; ++i)
+            ASSERT_EQ(c[pos++], round);
+    }
+    ASSERT_EQ(c.size(), pos);
+}
+
+TEST(vector, erase_if) {
+    vector<std::string> c;
+    for (int i = 0; i < 100; ++i)
+        c.push_back(std::to_string(i % 10));
+    ASSERT_EQ(erase(c, "3"), 10);
+    ASSERT_EQ(erase(c, std::string("3")), 0);
+    ASSERT_EQ(erase_if(c, [](const std::string& s) { return s < "5"; }), 40);
+    ASSERT_EQ(c.size(), 50);
+    ASSERT_EQ(c[0], "5");
+    ASSERT_EQ(c[5], "5");
+
+    // compacting thousands of scattered indices in one pass
+    vector<int> d(10000);
+    std::iota(d.begin(), d.end(), 0);
+    vector<std::size_t> indices;
+    for (std::size_t i = 0; i < d.size(); i += 3)
+        indices.push_back(i);
+    ASSERT_EQ(d.erase_indices(indices), 3334);
+    ASSERT_EQ(d.size(), 6666);
+    for (std::size_t i = 0; i < d.size(); ++i)
+        ASSERT_EQ(d[i], static_cast<int>(i / 2 * 3 + i % 2 + 1));
+}
+
+TEST(vector, ranges) {
+    const std::vector<int> source{1, 2, 3, 4, 5, 6, 7, 8};
+    auto evens = source | std::views::filter([](int v) { return v % 2 == 0; })
+                        | std::views::transform([](int v) { return v * 10; });
+
+    vector c(from_range, evens);
+    static_assert(std::is_same_v<decltype(c), vector<int>>);
+    expect_sequence(c, {20, 40, 60, 80});
+    ASSERT_EQ(c.capacity(), 4);
+
+    // a contiguous range of the element type is copied in one go
+    vector<int> d(from_range, source);
+    expect_sequence(d, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto it = d.insert_range(d.begin() + 2, evens);
+    ASSERT_EQ(*it, 20);
+    expect_sequence(d, {1, 2, 20, 40, 60, 80, 3, 4, 5, 6, 7, 8});
+    d.append_range(source | std::views::take(2));
+    ASSERT_EQ(d.size(), 14);
+    ASSERT_EQ(d.back(), 2);
+    d.assign_range(source | std::views::reverse);
+    expect_sequence(d, {8, 7, 6, 5, 4, 3, 2, 1});
+    d.assign_range(std::views::iota(0, 3));
+    expect_sequence(d, {0, 1, 2});
+
+    // a single-pass range of unknown size
+    std::istringstream in("7 8 9");
+    it = d.insert_range(d.begin() + 1, std::views::istream<int>(in));
+    ASSERT_EQ(*it, 7);
+    expect_sequence(d, {0, 7, 8, 9, 1, 2});
+    std::istringstream more("3 4");
+    d.append_range(std::views::istream<int>(more));
+    expect_sequence(d, {0, 7, 8, 9, 1, 2, 3, 4});
+    std::istringstream fewer("5");
+    d.assign_range(std::views::istream<int>(fewer));
+    expect_sequence(d, {5});
+
+    // a single-pass range of known size grows each buffer once
+    std::string numbers;
+    for (int i = 0; i < 100; ++i)
+        numbers += std::to_string(i) + ' ';
+    std::istringstream sized(numbers);
+    auto counted = std::views::counted(std::istream_iterator<int>(sized), 100);
+    static_assert(std::ranges::sized_range<decltype(counted)> && !std::ranges::forward_range<decltype(counted)>);
+    vector<int, counting_allocator<int>> f{1, 2, 3};
+    allocation_counter::allocations = 0;
+    f.assign_range(counted);
+    ASSERT_EQ(allocation_counter::allocations, 1);
+    ASSERT_EQ(f.size(), 100);
+    ASSERT_EQ(f[99], 99);
+    sized.clear();
+    sized.str(numbers);
+    f.shrink_to_fit();
+    allocation_counter::allocations = 0;
+    auto at = f.insert_range(f.begin() + 1, std::views::counted(std::istream_iterator<int>(sized), 100));
+    // the vector and the side buffer
+    ASSERT_EQ(allocation_counter::allocations, 2);
+    ASSERT_EQ(at - f.begin(), 1);
+    ASSERT_EQ(f.size(), 200);
+    ASSERT_EQ(f[1], 0);
+    ASSERT_EQ(f[100], 99);
+    ASSERT_EQ(f[101], 1);
+
+    // the element type converts from the range's
+    vector<std::string> e(from_range, std::views::iota(0, 12) | std::views::transform([](int v) {
+        return std::to_string(v);
+    }));
+    ASSERT_EQ(e.size(), 12);
+    e.insert_range(e.begin(), std::vector<const char*>{"a", "b"});
+    ASSERT_EQ(e[1], "b");
+    ASSERT_EQ(e[13], "11");
+}